@@ -0,0 +1,115 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#include "BoundaryConditions.hpp"
+
+#include "Tools/Logger.hpp"
+
+Blocks::BoundaryCondition* Blocks::BoundaryCondition::create(const std::string& description) {
+  if (description == "outflow") {
+    return new OutflowBoundary();
+  }
+  if (description == "reflective") {
+    return new ReflectiveBoundary();
+  }
+  if (description == "periodic") {
+    return new PeriodicBoundary();
+  }
+  if (description.starts_with("inflow:")) {
+    return new InflowBoundary(description.substr(7));
+  }
+
+  Tools::Logger::logger.error(("Unknown boundary condition " + description).c_str());
+  return nullptr;
+}
+
+void Blocks::BoundaryCondition::applyTracer(Side side, const RealType* h, RealType* hc, IndexType size, [[maybe_unused]] double time) {
+  const IndexType ghost = side == LEFT ? 0 : size + 1;
+  const IndexType inner = side == LEFT ? 1 : size;
+
+  hc[ghost] = h[inner] > RealType(0.0) ? h[ghost] * hc[inner] / h[inner] : RealType(0.0);
+}
+
+void Blocks::OutflowBoundary::apply(Side side, RealType* h, RealType* hu, IndexType size, [[maybe_unused]] double time) {
+  if (side == LEFT) {
+    h[0]  = h[1];
+    hu[0] = hu[1];
+  } else {
+    h[size + 1]  = h[size];
+    hu[size + 1] = hu[size];
+  }
+}
+
+void Blocks::ReflectiveBoundary::apply(Side side, RealType* h, RealType* hu, IndexType size, [[maybe_unused]] double time) {
+  if (side == LEFT) {
+    h[0]  = h[1];
+    hu[0] = -hu[1];
+  } else {
+    h[size + 1]  = h[size];
+    hu[size + 1] = -hu[size];
+  }
+}
+
+void Blocks::PeriodicBoundary::apply(Side side, RealType* h, RealType* hu, IndexType size, [[maybe_unused]] double time) {
+  if (side == LEFT) {
+    h[0]  = h[size];
+    hu[0] = hu[size];
+  } else {
+    h[size + 1]  = h[1];
+    hu[size + 1] = hu[1];
+  }
+}
+
+void Blocks::PeriodicBoundary::applyTracer(Side side, [[maybe_unused]] const RealType* h, RealType* hc, IndexType size, [[maybe_unused]] double time) {
+  if (side == LEFT) {
+    hc[0] = hc[size];
+  } else {
+    hc[size + 1] = hc[1];
+  }
+}
+
+Blocks::InflowBoundary::InflowBoundary(const std::string& fileName):
+  forcing_(fileName) {}
+
+void Blocks::InflowBoundary::apply(Side side, RealType* h, RealType* hu, IndexType size, double time) {
+  const IndexType ghost = side == LEFT ? 0 : size + 1;
+  const IndexType inner = side == LEFT ? 1 : size;
+
+  RealType forcedH, forcedHu;
+  forcing_.evaluate(time, forcedH, forcedHu);
+
+  h[ghost]  = forcedH;
+  hu[ghost] = forcing_.hasMomentum() ? forcedHu : hu[inner];
+}
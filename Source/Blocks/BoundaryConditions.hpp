@@ -0,0 +1,118 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#pragma once
+
+#include <string>
+
+#include "SWE1DExport.hpp"
+#include "Tools/ForcingTable.hpp"
+#include "Tools/IndexType.hpp"
+#include "Tools/RealType.hpp"
+
+namespace Blocks {
+
+  /**
+   * Sets the ghost cell of one side of the domain
+   *
+   * The unknowns h and hu are defined on [0,..,size+1], the ghost cells are
+   * 0 (LEFT) and size+1 (RIGHT).
+   */
+  class SWE1D_EXPORT BoundaryCondition {
+  public:
+    enum Side { LEFT, RIGHT };
+
+    virtual ~BoundaryCondition() = default;
+
+    virtual void apply(Side side, RealType* h, RealType* hu, IndexType size, double time) = 0;
+
+    /**
+     * Sets the ghost cell of a passive tracer hc, must be called after apply()
+     *
+     * The default keeps the concentration c of the adjacent inner cell.
+     */
+    virtual void applyTracer(Side side, const RealType* h, RealType* hc, IndexType size, double time);
+
+    /**
+     * Creates a boundary condition from a description
+     *
+     * @param description outflow, reflective, periodic or inflow:FILE
+     *  (see Tools::ForcingTable for the file format)
+     * @return A new boundary condition, owned by the caller
+     */
+    static BoundaryCondition* create(const std::string& description);
+  };
+
+  /**
+   * Zero gradient: copies the values of the adjacent inner cell
+   */
+  class SWE1D_EXPORT OutflowBoundary: public BoundaryCondition {
+  public:
+    void apply(Side side, RealType* h, RealType* hu, IndexType size, double time) override;
+  };
+
+  /**
+   * Wall: copies the water height and mirrors the momentum
+   */
+  class SWE1D_EXPORT ReflectiveBoundary: public BoundaryCondition {
+  public:
+    void apply(Side side, RealType* h, RealType* hu, IndexType size, double time) override;
+  };
+
+  /**
+   * Copies the values of the inner cell at the opposite side of the domain
+   * (should be used on both sides)
+   */
+  class SWE1D_EXPORT PeriodicBoundary: public BoundaryCondition {
+  public:
+    void apply(Side side, RealType* h, RealType* hu, IndexType size, double time) override;
+    void applyTracer(Side side, const RealType* h, RealType* hc, IndexType size, double time) override;
+  };
+
+  /**
+   * Prescribes the water height (and momentum) from a streamed time series.
+   * If the series contains no momentum, it is extrapolated from the domain.
+   */
+  class SWE1D_EXPORT InflowBoundary: public BoundaryCondition {
+  private:
+    Tools::ForcingTable forcing_;
+
+  public:
+    InflowBoundary(const std::string& fileName);
+
+    void apply(Side side, RealType* h, RealType* hu, IndexType size, double time) override;
+  };
+
+} // namespace Blocks
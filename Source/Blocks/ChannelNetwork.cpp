@@ -0,0 +1,341 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#include "ChannelNetwork.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <queue>
+
+namespace {
+  /**
+   * Keeps the ghost cell of a reach end that is set by a junction
+   */
+  class JunctionBoundary: public Blocks::BoundaryCondition {
+  public:
+    void apply(
+      [[maybe_unused]] Side      side,
+      [[maybe_unused]] RealType* h,
+      [[maybe_unused]] RealType* hu,
+      [[maybe_unused]] IndexType size,
+      [[maybe_unused]] double    time
+    ) override {}
+  };
+
+  JunctionBoundary junctionBoundary;
+
+  /** Direction of the discharge into the junction */
+  RealType sign(Blocks::BoundaryCondition::Side side) { return side == Blocks::BoundaryCondition::RIGHT ? RealType(1.0) : RealType(-1.0); }
+} // namespace
+
+Blocks::ChannelNetwork::ChannelNetwork(unsigned int numThreads):
+  localTimeStepping_(false),
+  time_(0),
+  numThreads_(std::max(numThreads, 1u)),
+  barrier_(numThreads_),
+  finished_(false),
+  assignment_(numThreads_),
+  balanced_(false) {
+
+  for (unsigned int i = 1; i < numThreads_; i++) {
+    workers_.emplace_back(&ChannelNetwork::work, this, i);
+  }
+}
+
+Blocks::ChannelNetwork::~ChannelNetwork() {
+  // Release the workers waiting for the next phase
+  finished_ = true;
+  barrier_.arrive_and_wait();
+  for (std::thread& worker : workers_) {
+    worker.join();
+  }
+
+  // Free allocated memory
+  for (Reach& reach : reaches_) {
+    delete reach.block;
+    delete[] reach.h;
+    delete[] reach.hu;
+  }
+}
+
+unsigned int Blocks::ChannelNetwork::addReach(const Scenarios::Scenario& scenario, IndexType size) {
+  Reach reach;
+  reach.size = size;
+  reach.h    = new RealType[size + 2];
+  reach.hu   = new RealType[size + 2];
+
+  // Initialize water height and momentum
+  for (IndexType i = 0; i < size + 2; i++) {
+    reach.h[i]  = scenario.getHeight(i);
+    reach.hu[i] = scenario.getMomentum(i);
+  }
+
+  reach.block             = new WavePropagationBlock(reach.h, reach.hu, size, scenario.getCellSize());
+  reach.boundaries[0]     = nullptr;
+  reach.boundaries[1]     = nullptr;
+  reach.maxTimeStep       = RealType(0.0);
+  reach.numSubsteps       = 1;
+  reach.junctionFluxes[0] = RealType(0.0);
+  reach.junctionFluxes[1] = RealType(0.0);
+
+  reaches_.push_back(reach);
+  balanced_ = false;
+
+  return static_cast<unsigned int>(reaches_.size() - 1);
+}
+
+unsigned int Blocks::ChannelNetwork::addJunction() {
+  junctions_.emplace_back();
+  return static_cast<unsigned int>(junctions_.size() - 1);
+}
+
+void Blocks::ChannelNetwork::connect(unsigned int junction, unsigned int reach, BoundaryCondition::Side side) {
+  junctions_[junction].push_back({reach, side});
+  setBoundaryCondition(reach, side, &junctionBoundary);
+}
+
+void Blocks::ChannelNetwork::setBoundaryCondition(unsigned int reach, BoundaryCondition::Side side, BoundaryCondition* boundary) {
+  Reach& r = reaches_[reach];
+
+  r.boundaries[side] = boundary;
+  r.block->setBoundaryConditions(r.boundaries[BoundaryCondition::LEFT], r.boundaries[BoundaryCondition::RIGHT]);
+}
+
+void Blocks::ChannelNetwork::setLocalTimeStepping(bool enabled) { localTimeStepping_ = enabled; }
+
+void Blocks::ChannelNetwork::work(unsigned int worker) {
+  while (true) {
+    // Wait for the next phase
+    barrier_.arrive_and_wait();
+    if (finished_) {
+      break;
+    }
+
+    for (const unsigned int reach : assignment_[worker]) {
+      phase_(reaches_[reach]);
+    }
+
+    barrier_.arrive_and_wait();
+  }
+}
+
+void Blocks::ChannelNetwork::runParallel(const std::function<void(Reach&)>& phase) {
+  phase_ = phase;
+
+  barrier_.arrive_and_wait();
+  for (const unsigned int reach : assignment_[0]) {
+    phase_(reaches_[reach]);
+  }
+  barrier_.arrive_and_wait();
+}
+
+void Blocks::ChannelNetwork::balance() {
+  // Longest processing time first: largest reach to the least loaded worker
+  std::vector<unsigned int> order(reaches_.size());
+  std::iota(order.begin(), order.end(), 0u);
+
+  auto cost = [this](unsigned int reach) { return double(reaches_[reach].size) * reaches_[reach].numSubsteps; };
+  std::sort(order.begin(), order.end(), [&cost](unsigned int a, unsigned int b) { return cost(a) > cost(b); });
+
+  using Load = std::pair<double, unsigned int>;
+  std::priority_queue<Load, std::vector<Load>, std::greater<Load>> loads;
+  for (unsigned int i = 0; i < numThreads_; i++) {
+    assignment_[i].clear();
+    loads.push({0.0, i});
+  }
+
+  for (const unsigned int reach : order) {
+    Load load = loads.top();
+    loads.pop();
+
+    assignment_[load.second].push_back(reach);
+    load.first += cost(reach);
+    loads.push(load);
+  }
+
+  balanced_ = true;
+}
+
+void Blocks::ChannelNetwork::applyJunctionConditions() {
+  for (const std::vector<Connection>& junction : junctions_) {
+    if (junction.size() == 2) {
+      // Continuous channel: the ghost cell of one reach is the first inner cell of the other
+      for (unsigned int k = 0; k < 2; k++) {
+        const Connection& self  = junction[k];
+        const Connection& other = junction[1 - k];
+        const Reach&      a     = reaches_[self.reach];
+        const Reach&      b     = reaches_[other.reach];
+
+        const IndexType ghost = self.side == BoundaryCondition::LEFT ? 0 : a.size + 1;
+        const IndexType inner = other.side == BoundaryCondition::LEFT ? 1 : b.size;
+
+        a.h[ghost]  = b.h[inner];
+        a.hu[ghost] = -sign(self.side) * sign(other.side) * b.hu[inner];
+      }
+      continue;
+    }
+
+    // Common water level and zero total discharge into the junction
+    RealType level     = RealType(0.0);
+    RealType discharge = RealType(0.0);
+    for (const Connection& connection : junction) {
+      const Reach&    r     = reaches_[connection.reach];
+      const IndexType inner = connection.side == BoundaryCondition::LEFT ? 1 : r.size;
+
+      level += r.h[inner];
+      discharge += sign(connection.side) * r.hu[inner];
+    }
+    level /= RealType(junction.size());
+    discharge /= RealType(junction.size());
+
+    for (const Connection& connection : junction) {
+      const Reach&    r     = reaches_[connection.reach];
+      const IndexType inner = connection.side == BoundaryCondition::LEFT ? 1 : r.size;
+      const IndexType ghost = connection.side == BoundaryCondition::LEFT ? 0 : r.size + 1;
+
+      r.h[ghost]  = level;
+      r.hu[ghost] = r.hu[inner] - sign(connection.side) * discharge;
+    }
+  }
+}
+
+void Blocks::ChannelNetwork::shareJunctionFluxes() {
+  for (const std::vector<Connection>& junction : junctions_) {
+    // Total discharge into the junction
+    RealType discharge = RealType(0.0);
+    for (const Connection& connection : junction) {
+      discharge += sign(connection.side) * reaches_[connection.reach].block->getBoundaryMassFlux(connection.side);
+    }
+    discharge /= RealType(junction.size());
+
+    for (const Connection& connection : junction) {
+      Reach& r = reaches_[connection.reach];
+
+      r.junctionFluxes[connection.side] = r.block->getBoundaryMassFlux(connection.side) - sign(connection.side) * discharge;
+      r.block->setBoundaryMassFlux(connection.side, r.junctionFluxes[connection.side]);
+    }
+  }
+}
+
+void Blocks::ChannelNetwork::applyJunctionFluxes(Reach& reach) const {
+  for (const BoundaryCondition::Side side : {BoundaryCondition::LEFT, BoundaryCondition::RIGHT}) {
+    if (reach.boundaries[side] == &junctionBoundary) {
+      reach.block->setBoundaryMassFlux(side, reach.junctionFluxes[side]);
+    }
+  }
+}
+
+RealType Blocks::ChannelNetwork::step() {
+  if (!balanced_) {
+    balance();
+  }
+
+  // Ghost cells at junctions (serial, reads the inner cells of several reaches)
+  applyJunctionConditions();
+
+  // Ghost cells at open ends and CFL condition of each reach
+  const double time = time_;
+  runParallel([time](Reach& reach) {
+    reach.block->applyBoundaryConditions(time);
+    reach.maxTimeStep = reach.block->computeNumericalFluxes();
+  });
+
+  // Conservative fluxes at junctions (serial, reads the fluxes of several reaches)
+  shareJunctionFluxes();
+
+  RealType dt;
+  if (!localTimeStepping_) {
+    // Global CFL condition
+    dt = std::numeric_limits<RealType>::max();
+    for (const Reach& reach : reaches_) {
+      dt = std::min(dt, reach.maxTimeStep);
+    }
+
+    runParallel([dt](Reach& reach) { reach.block->updateUnknowns(dt); });
+  } else {
+    // The coarsest reach does one step, all others subcycle with their own CFL condition
+    dt = RealType(0.0);
+    for (const Reach& reach : reaches_) {
+      dt = std::max(dt, reach.maxTimeStep);
+    }
+
+    runParallel([this, dt, time](Reach& reach) {
+      RealType localTime = RealType(0.0);
+      reach.numSubsteps  = 0;
+
+      while (true) {
+        // The last substep ends exactly at the end of the network time step (no tiny remainder),
+        // so all ends of a junction exchange their shared flux for the same time
+        const RealType remaining = dt - localTime;
+        const bool     last      = reach.maxTimeStep >= remaining - dt * RealType(1e-6);
+        const RealType subStep   = last ? remaining : reach.maxTimeStep;
+        reach.block->updateUnknowns(subStep);
+
+        localTime += subStep;
+        reach.numSubsteps++;
+        if (last) {
+          break;
+        }
+
+        // Junction ghost cells and fluxes are kept constant
+        reach.block->applyBoundaryConditions(time + localTime);
+        reach.maxTimeStep = reach.block->computeNumericalFluxes();
+        applyJunctionFluxes(reach);
+      }
+    });
+
+    // Costs changed with the number of substeps
+    balanced_ = false;
+  }
+
+  time_ += dt;
+
+  return dt;
+}
+
+double Blocks::ChannelNetwork::getTime() const { return time_; }
+
+unsigned int Blocks::ChannelNetwork::getNumReaches() const { return static_cast<unsigned int>(reaches_.size()); }
+
+unsigned int Blocks::ChannelNetwork::getNumThreads() const { return numThreads_; }
+
+IndexType Blocks::ChannelNetwork::getSize(unsigned int reach) const { return reaches_[reach].size; }
+
+const RealType* Blocks::ChannelNetwork::getHeight(unsigned int reach) const { return reaches_[reach].h; }
+
+const RealType* Blocks::ChannelNetwork::getMomentum(unsigned int reach) const { return reaches_[reach].hu; }
+
+Blocks::WavePropagationBlock& Blocks::ChannelNetwork::getBlock(unsigned int reach) { return *reaches_[reach].block; }
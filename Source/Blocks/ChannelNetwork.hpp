@@ -0,0 +1,215 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#pragma once
+
+#include <barrier>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include "Blocks/BoundaryConditions.hpp"
+#include "Blocks/WavePropagationBlock.hpp"
+#include "Scenarios/Scenario.hpp"
+#include "SWE1DExport.hpp"
+#include "Tools/IndexType.hpp"
+#include "Tools/RealType.hpp"
+
+namespace Blocks {
+
+  /**
+   * A network of 1D reaches connected at junctions
+   *
+   * Each reach is a WavePropagationBlock with its own size and cell size.
+   * Reach ends that are not connected to a junction use a boundary
+   * condition (outflow by default).
+   *
+   * Junction conditions fill the ghost cells of all connected reach ends:
+   *  - Two reaches: the ghost cell of each reach gets the values of the first
+   *    inner cell of the other reach, i.e. the junction behaves like a
+   *    continuous channel (and is conservative for equal cell sizes).
+   *  - More reaches: all ghost cells get the mean water level of the adjacent
+   *    cells and their discharges are corrected equally, such that the total
+   *    discharge into the junction is zero.
+   *
+   * The ghost cells only approximate the junction, the reaches compute the
+   * fluxes through their end edges independently. After the flux
+   * computation, the mass fluxes of all ends of a junction are therefore
+   * corrected equally such that they sum up to zero and replace the h net
+   * updates of the end edges. The network conserves mass up to round-off.
+   * With local time stepping, the shared flux of the network time step is
+   * kept for all substeps (like the ghost cells), and the substeps of every
+   * reach end exactly at the end of the network time step.
+   *
+   * Reaches are distributed over a persistent pool of threads. The
+   * assignment balances the number of cells (times the number of substeps
+   * with local time stepping), largest reaches first.
+   */
+  class SWE1D_EXPORT ChannelNetwork {
+  private:
+    struct Reach {
+      IndexType size;
+      /** Water height (including ghost cells) */
+      RealType* h;
+      /** Momentum (including ghost cells) */
+      RealType* hu;
+
+      WavePropagationBlock* block;
+
+      /** Boundary conditions of the ends (not owned) */
+      BoundaryCondition* boundaries[2];
+
+      /** CFL time step of the last flux computation */
+      RealType maxTimeStep;
+      /** Number of time steps in the last step of the network */
+      unsigned int numSubsteps;
+      /** Shared mass flux of the ends connected to a junction (positive to the right) */
+      RealType junctionFluxes[2];
+    };
+
+    struct Connection {
+      unsigned int            reach;
+      BoundaryCondition::Side side;
+    };
+
+    std::vector<Reach>                   reaches_;
+    std::vector<std::vector<Connection>> junctions_;
+
+    /** Step reaches with their own CFL condition between two junction updates */
+    bool localTimeStepping_;
+
+    double time_;
+
+    // Thread pool, the calling thread is worker 0
+    unsigned int                numThreads_;
+    std::vector<std::thread>    workers_;
+    std::barrier<>              barrier_;
+    std::function<void(Reach&)> phase_;
+    bool                        finished_;
+
+    /** Reaches assigned to each worker */
+    std::vector<std::vector<unsigned int>> assignment_;
+    bool                                   balanced_;
+
+    void work(unsigned int worker);
+
+    /**
+     * Runs phase on all reaches in parallel
+     */
+    void runParallel(const std::function<void(Reach&)>& phase);
+
+    /**
+     * Assigns reaches to threads, balancing the estimated cost
+     */
+    void balance();
+
+    void applyJunctionConditions();
+
+    /**
+     * Replaces the fluxes of the reach ends at junctions by conservative shared fluxes
+     */
+    void shareJunctionFluxes();
+
+    /**
+     * Sets the shared fluxes of the junction ends of a reach (after a flux computation)
+     */
+    void applyJunctionFluxes(Reach& reach) const;
+
+  public:
+    /**
+     * @param numThreads Number of threads (including the calling thread)
+     */
+    ChannelNetwork(unsigned int numThreads = std::thread::hardware_concurrency());
+    ~ChannelNetwork();
+
+    ChannelNetwork(const ChannelNetwork&)            = delete;
+    ChannelNetwork& operator=(const ChannelNetwork&) = delete;
+
+    /**
+     * Adds a reach initialized from a scenario
+     *
+     * @param size Number of cells of the reach
+     * @return Index of the reach
+     */
+    unsigned int addReach(const Scenarios::Scenario& scenario, IndexType size);
+
+    /**
+     * @return Index of the new junction
+     */
+    unsigned int addJunction();
+
+    /**
+     * Connects one end of a reach to a junction
+     */
+    void connect(unsigned int junction, unsigned int reach, BoundaryCondition::Side side);
+
+    /**
+     * Sets the boundary condition of an end that is not connected to a junction
+     *
+     * @param boundary Boundary condition (not owned), nullptr for outflow
+     */
+    void setBoundaryCondition(unsigned int reach, BoundaryCondition::Side side, BoundaryCondition* boundary);
+
+    /**
+     * @param enabled If true, each reach is advanced with its own CFL time step
+     *  until the end of the network time step (= the largest CFL time step of
+     *  all reaches), junctions are only updated once per network time step.
+     *  Otherwise, all reaches use the smallest CFL time step.
+     */
+    void setLocalTimeStepping(bool enabled);
+
+    /**
+     * Does one time step of the network
+     *
+     * @return The time step size
+     */
+    RealType step();
+
+    double       getTime() const;
+    unsigned int getNumReaches() const;
+    unsigned int getNumThreads() const;
+
+    IndexType getSize(unsigned int reach) const;
+
+    /**
+     * @return Unknowns of a reach including ghost cells (inner cells are [1,..,size])
+     */
+    const RealType* getHeight(unsigned int reach) const;
+    const RealType* getMomentum(unsigned int reach) const;
+
+    WavePropagationBlock& getBlock(unsigned int reach);
+  };
+
+} // namespace Blocks
@@ -0,0 +1,84 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "Tools/IndexType.hpp"
+#include "Tools/RealType.hpp"
+
+namespace Blocks {
+
+  /**
+   * Scalar diagnostics of the unknowns, reduced during the update sweep.
+   *
+   * Partial results of disjoint cell ranges can be merged with combine(),
+   * which makes the reduction safe to split across threads.
+   */
+  struct Diagnostics {
+    /** Total mass, i.e. sum of h * cellSize */
+    RealType mass = RealType(0.0);
+    /** Total momentum, i.e. sum of hu * cellSize */
+    RealType momentum = RealType(0.0);
+    /** Maximum water height */
+    RealType maxHeight = RealType(0.0);
+    /** Maximum particle speed |u| = |hu/h| */
+    RealType maxSpeed = RealType(0.0);
+    /** Right-most cell with |hu| above the front threshold (0 if there is none) */
+    IndexType frontCell = 0;
+
+    void combine(const Diagnostics& other) {
+      mass += other.mass;
+      momentum += other.momentum;
+      maxHeight = std::max(maxHeight, other.maxHeight);
+      maxSpeed  = std::max(maxSpeed, other.maxSpeed);
+      frontCell = std::max(frontCell, other.frontCell);
+    }
+
+    /**
+     * @return Position of the front (center of the front cell)
+     */
+    RealType getFrontPosition(RealType cellSize) const { return frontCell == 0 ? RealType(0.0) : (RealType(frontCell) - RealType(0.5)) * cellSize; }
+
+    /**
+     * @param cellCenters Centers of the inner cells of a non-uniform grid
+     * @return Position of the front (center of the front cell)
+     */
+    RealType getFrontPosition(const std::vector<RealType>& cellCenters) const { return frontCell == 0 ? RealType(0.0) : cellCenters[frontCell - 1]; }
+  };
+
+} // namespace Blocks
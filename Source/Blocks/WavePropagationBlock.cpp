@@ -36,36 +36,117 @@
 
 #include "WavePropagationBlock.hpp"
 
-Blocks::WavePropagationBlock::WavePropagationBlock(RealType* h, RealType* hu, unsigned int size, RealType cellSize):
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+  /** Gravity as used by the f-wave solver */
+  constexpr RealType Gravity = RealType(9.81);
+
+  /** Lower bound of the water height in the friction term (avoids the division by zero in dry cells) */
+  constexpr RealType FrictionDryTolerance = RealType(1e-6);
+
+  /**
+   * Exact solution of d(hu)/dt = -k*|u|*hu over dt with frozen h and k
+   */
+  template <Blocks::WavePropagationBlockBase::FrictionLaw Friction>
+  inline RealType applyFriction(RealType dt, RealType h, RealType hu, RealType coefficient) {
+    if constexpr (Friction == Blocks::WavePropagationBlockBase::NO_FRICTION) {
+      return hu;
+    } else {
+      const RealType hSafe = std::max(h, FrictionDryTolerance);
+      const RealType speed = std::abs(hu) / hSafe;
+
+      RealType k;
+      if constexpr (Friction == Blocks::WavePropagationBlockBase::MANNING) {
+        k = Gravity * coefficient * coefficient / (hSafe * std::cbrt(hSafe));
+      } else {
+        k = Gravity / (coefficient * coefficient * hSafe);
+      }
+
+      return hu / (RealType(1.0) + dt * k * speed);
+    }
+  }
+
+  /**
+   * Particle speed |u|, dry cells have no speed
+   */
+  inline RealType speedOf(RealType h, RealType hu) { return h > RealType(0.0) ? std::abs(hu) / std::max(h, RealType(1e-12)) : RealType(0.0); }
+
+  /**
+   * Folds the new values of one cell into its envelope (branch-free, so the sweep stays vectorized)
+   */
+  inline void updateEnvelope(RealType h, RealType hu, RealType time, RealType threshold, RealType& maxDepth, RealType& maxSpeed, RealType& arrivalTime) {
+    maxDepth    = std::max(maxDepth, h);
+    maxSpeed    = std::max(maxSpeed, speedOf(h, hu));
+    arrivalTime = arrivalTime < RealType(0.0) && std::abs(hu) > threshold ? time : arrivalTime;
+  }
+
+} // namespace
+
+template <unsigned int NumTracers>
+Blocks::BasicWavePropagationBlock<NumTracers>::BasicWavePropagationBlock(
+  RealType* h, RealType* hu, IndexType size, RealType cellSize, const std::array<RealType*, NumTracers>& tracers
+):
   h_(h),
   hu_(hu),
+  tracers_(tracers),
   size_(size),
-  cellSize_(cellSize) {
+  cellSize_(cellSize),
+  leftBoundary_(nullptr),
+  rightBoundary_(nullptr),
+  diagnosticsEnabled_(false),
+  frontThreshold_(RealType(1e-3)),
+  envelopeEnabled_(false),
+  frictionLaw_(NO_FRICTION) {
 
   // Allocate net updates
   hNetUpdatesLeft_   = new RealType[size + 1];
   hNetUpdatesRight_  = new RealType[size + 1];
   huNetUpdatesLeft_  = new RealType[size + 1];
   huNetUpdatesRight_ = new RealType[size + 1];
+  for (RealType*& concentrations : tracerConcentrations_) {
+    concentrations = new RealType[size + 1];
+  }
 }
 
-Blocks::WavePropagationBlock::~WavePropagationBlock() {
+template <unsigned int NumTracers>
+Blocks::BasicWavePropagationBlock<NumTracers>::~BasicWavePropagationBlock() {
   // Free allocated memory
   delete[] hNetUpdatesLeft_;
   delete[] hNetUpdatesRight_;
   delete[] huNetUpdatesLeft_;
   delete[] huNetUpdatesRight_;
+  for (RealType* concentrations : tracerConcentrations_) {
+    delete[] concentrations;
+  }
 }
 
-RealType Blocks::WavePropagationBlock::computeNumericalFluxes() {
+template <unsigned int NumTracers>
+RealType Blocks::BasicWavePropagationBlock<NumTracers>::computeNumericalFluxes() {
+  // Loop over all edges
+  const RealType maxWaveSpeed = computeNumericalFluxes(0, size_ + 1);
+
+  // Compute CFL condition
+  return getMaxTimeStep(maxWaveSpeed);
+}
+
+template <unsigned int NumTracers>
+RealType Blocks::BasicWavePropagationBlock<NumTracers>::computeNumericalFluxes(IndexType begin, IndexType end) {
+  // The solver keeps intermediate state, so every (concurrent) call needs its own
+  Solvers::FWaveSolver<RealType> solver;
+
   RealType maxWaveSpeed = RealType(0.0);
 
-  // Loop over all edges
-  for (unsigned int i = 1; i < size_ + 2; i++) {
+  // Only set for non-uniform grids
+  const RealType* inverseCellSizes = inverseCellSizes_.empty() ? nullptr : inverseCellSizes_.data();
+
+  for (IndexType i = begin + 1; i < end + 1; i++) {
     RealType maxEdgeSpeed = RealType(0.0);
 
     // Compute net updates
-    solver_.computeNetUpdates(
+    solver.computeNetUpdates(
       h_[i - 1],
       h_[i],
       hu_[i - 1],
@@ -79,30 +160,343 @@ RealType Blocks::WavePropagationBlock::computeNumericalFluxes() {
       maxEdgeSpeed
     );
 
+    if constexpr (NumTracers > 0) {
+      // Upwind cell of the mass flux of the f-wave solution, a dry cell (no water to carry a concentration) takes the other one
+      const RealType massFlux = hu_[i - 1] + hNetUpdatesLeft_[i - 1];
+      IndexType      upwind   = massFlux > RealType(0.0) ? i - 1 : i;
+      if (!(h_[upwind] > RealType(0.0))) {
+        upwind = 2 * i - 1 - upwind;
+      }
+      const RealType hUpwind = h_[upwind];
+      for (unsigned int k = 0; k < NumTracers; k++) {
+        tracerConcentrations_[k][i - 1] = hUpwind > RealType(0.0) ? tracers_[k][upwind] / hUpwind : RealType(0.0);
+      }
+    }
+
+    // The waves of the edge enter both cells, the smaller one limits the time step
+    if (inverseCellSizes) {
+      maxEdgeSpeed *= cellSize_ * std::max(inverseCellSizes[i - 1], inverseCellSizes[i]);
+    }
+
     // Update maxWaveSpeed
     if (maxEdgeSpeed > maxWaveSpeed) {
       maxWaveSpeed = maxEdgeSpeed;
     }
   }
 
-  // Compute CFL condition
-  RealType maxTimeStep = cellSize_ / maxWaveSpeed * RealType(0.4);
+  return maxWaveSpeed;
+}
+
+template <unsigned int NumTracers>
+RealType Blocks::BasicWavePropagationBlock<NumTracers>::getBoundaryMassFlux(BoundaryCondition::Side side) const {
+  // Flux of the f-wave solution, seen from the inner cell
+  if (side == BoundaryCondition::LEFT) {
+    return hu_[1] - hNetUpdatesRight_[0];
+  }
 
-  return maxTimeStep;
+  return hu_[size_] + hNetUpdatesLeft_[size_];
+}
+
+template <unsigned int NumTracers>
+void Blocks::BasicWavePropagationBlock<NumTracers>::setBoundaryMassFlux(BoundaryCondition::Side side, RealType flux) {
+  if (side == BoundaryCondition::LEFT) {
+    hNetUpdatesRight_[0] = hu_[1] - flux;
+  } else {
+    hNetUpdatesLeft_[size_] = flux - hu_[size_];
+  }
 }
 
-void Blocks::WavePropagationBlock::updateUnknowns(RealType dt) {
+template <unsigned int NumTracers>
+RealType Blocks::BasicWavePropagationBlock<NumTracers>::getMaxTimeStep(RealType maxWaveSpeed) const { return cellSize_ / maxWaveSpeed * RealType(0.4); }
+
+template <unsigned int NumTracers>
+void Blocks::BasicWavePropagationBlock<NumTracers>::updateUnknowns(RealType dt, double time) {
   // Loop over all inner cells
-  for (unsigned int i = 1; i < size_ + 1; i++) {
-    h_[i] -= dt / cellSize_ * (hNetUpdatesRight_[i - 1] + hNetUpdatesLeft_[i]);
-    hu_[i] -= dt / cellSize_ * (huNetUpdatesRight_[i - 1] + huNetUpdatesLeft_[i]);
+  if (diagnosticsEnabled_) {
+    diagnostics_ = Diagnostics();
+    updateUnknowns(dt, 1, size_ + 1, &diagnostics_, time);
+  } else {
+    updateUnknowns(dt, 1, size_ + 1, nullptr, time);
+  }
+}
+
+template <unsigned int NumTracers>
+void Blocks::BasicWavePropagationBlock<NumTracers>::updateUnknowns(RealType dt, IndexType begin, IndexType end, Diagnostics* diagnostics, double time) {
+  const bool computeDiagnostics = diagnosticsEnabled_ && diagnostics != nullptr;
+
+  if (computeDiagnostics && envelopeEnabled_) {
+    updateUnknownsFriction<true, true>(dt, begin, end, diagnostics, RealType(time));
+  } else if (computeDiagnostics) {
+    updateUnknownsFriction<true, false>(dt, begin, end, diagnostics, RealType(time));
+  } else if (envelopeEnabled_) {
+    updateUnknownsFriction<false, true>(dt, begin, end, nullptr, RealType(time));
+  } else {
+    updateUnknownsFriction<false, false>(dt, begin, end, nullptr, RealType(time));
+  }
+}
+
+template <unsigned int NumTracers>
+template <bool ComputeDiagnostics, bool TrackEnvelope>
+void Blocks::BasicWavePropagationBlock<NumTracers>::updateUnknownsFriction(RealType dt, IndexType begin, IndexType end, Diagnostics* diagnostics, RealType time) {
+  switch (frictionLaw_) {
+  case MANNING:
+    updateUnknownsGrid<ComputeDiagnostics, TrackEnvelope, MANNING>(dt, begin, end, diagnostics, time);
+    break;
+  case CHEZY:
+    updateUnknownsGrid<ComputeDiagnostics, TrackEnvelope, CHEZY>(dt, begin, end, diagnostics, time);
+    break;
+  default:
+    updateUnknownsGrid<ComputeDiagnostics, TrackEnvelope, NO_FRICTION>(dt, begin, end, diagnostics, time);
+    break;
   }
 }
 
-void Blocks::WavePropagationBlock::setOutflowBoundaryConditions() {
+template <unsigned int NumTracers>
+template <bool ComputeDiagnostics, bool TrackEnvelope, Blocks::WavePropagationBlockBase::FrictionLaw Friction>
+void Blocks::BasicWavePropagationBlock<NumTracers>::updateUnknownsGrid(RealType dt, IndexType begin, IndexType end, Diagnostics* diagnostics, RealType time) {
+  if (inverseCellSizes_.empty()) {
+    updateUnknownsKernel<ComputeDiagnostics, TrackEnvelope, Friction, false>(dt, begin, end, diagnostics, time);
+  } else {
+    updateUnknownsKernel<ComputeDiagnostics, TrackEnvelope, Friction, true>(dt, begin, end, diagnostics, time);
+  }
+}
+
+template <unsigned int NumTracers>
+template <bool ComputeDiagnostics, bool TrackEnvelope, Blocks::WavePropagationBlockBase::FrictionLaw Friction, bool Graded>
+void Blocks::BasicWavePropagationBlock<NumTracers>::updateUnknownsKernel(RealType dt, IndexType begin, IndexType end, Diagnostics* diagnostics, RealType time) {
+  // Only dereferenced if friction is enabled
+  const RealType* friction = frictionCoefficients_.data();
+
+  // Only dereferenced if the envelope is enabled
+  RealType* envelopeDepth   = envelope_.maxDepth.data();
+  RealType* envelopeSpeed   = envelope_.maxSpeed.data();
+  RealType* envelopeArrival = envelope_.arrivalTime.data();
+
+  // Only dereferenced on non-uniform grids
+  const RealType* cellSizes        = cellSizes_.data();
+  const RealType* inverseCellSizes = inverseCellSizes_.data();
+  const RealType  dtOverCellSize   = dt / cellSize_;
+
+  const std::array<RealType*, NumTracers> tracers              = tracers_;
+  const std::array<RealType*, NumTracers> tracerConcentrations = tracerConcentrations_;
+
+  if constexpr (!ComputeDiagnostics) {
+#pragma omp simd
+    for (IndexType i = begin; i < end; i++) {
+      const RealType dtOverDx = Graded ? dt * inverseCellSizes[i] : dtOverCellSize;
+      const RealType h        = h_[i] - dtOverDx * (hNetUpdatesRight_[i - 1] + hNetUpdatesLeft_[i]);
+      RealType       hu       = hu_[i] - dtOverDx * (huNetUpdatesRight_[i - 1] + huNetUpdatesLeft_[i]);
+      if constexpr (Friction != NO_FRICTION) {
+        hu = applyFriction<Friction>(dt, h, hu, friction[i]);
+      }
+
+      if constexpr (NumTracers > 0) {
+        // Mass fluxes through the right and the left edge as applied to h (with hu before the update)
+        const RealType massFluxRight = hu_[i] + hNetUpdatesLeft_[i];
+        const RealType massFluxLeft  = hu_[i] - hNetUpdatesRight_[i - 1];
+        for (unsigned int k = 0; k < NumTracers; k++) {
+          tracers[k][i] -= dtOverDx * (massFluxRight * tracerConcentrations[k][i] - massFluxLeft * tracerConcentrations[k][i - 1]);
+        }
+      }
+
+      h_[i]  = h;
+      hu_[i] = hu;
+
+      if constexpr (TrackEnvelope) {
+        updateEnvelope(h, hu, time, frontThreshold_, envelopeDepth[i], envelopeSpeed[i], envelopeArrival[i]);
+      }
+    }
+  } else {
+    // Reduce the diagnostics of the new values while they are still in registers
+    RealType  mass      = RealType(0.0);
+    RealType  momentum  = RealType(0.0);
+    RealType  maxHeight = RealType(0.0);
+    RealType  maxSpeed  = RealType(0.0);
+    IndexType frontCell = 0;
+
+#pragma omp simd reduction(+ : mass, momentum) reduction(max : maxHeight, maxSpeed, frontCell)
+    for (IndexType i = begin; i < end; i++) {
+      const RealType dtOverDx = Graded ? dt * inverseCellSizes[i] : dtOverCellSize;
+      const RealType h        = h_[i] - dtOverDx * (hNetUpdatesRight_[i - 1] + hNetUpdatesLeft_[i]);
+      RealType       hu       = hu_[i] - dtOverDx * (huNetUpdatesRight_[i - 1] + huNetUpdatesLeft_[i]);
+      if constexpr (Friction != NO_FRICTION) {
+        hu = applyFriction<Friction>(dt, h, hu, friction[i]);
+      }
+
+      if constexpr (NumTracers > 0) {
+        // Mass fluxes through the right and the left edge as applied to h (with hu before the update)
+        const RealType massFluxRight = hu_[i] + hNetUpdatesLeft_[i];
+        const RealType massFluxLeft  = hu_[i] - hNetUpdatesRight_[i - 1];
+        for (unsigned int k = 0; k < NumTracers; k++) {
+          tracers[k][i] -= dtOverDx * (massFluxRight * tracerConcentrations[k][i] - massFluxLeft * tracerConcentrations[k][i - 1]);
+        }
+      }
+
+      h_[i]  = h;
+      hu_[i] = hu;
+
+      if constexpr (TrackEnvelope) {
+        updateEnvelope(h, hu, time, frontThreshold_, envelopeDepth[i], envelopeSpeed[i], envelopeArrival[i]);
+      }
+
+      // Cell widths of a non-uniform grid are integrated per cell, the uniform one is applied at the end
+      const RealType width = Graded ? cellSizes[i] : RealType(1.0);
+      mass += h * width;
+      momentum += hu * width;
+      maxHeight = std::max(maxHeight, h);
+      // Dry cells do not count towards the maximum speed
+      maxSpeed  = std::max(maxSpeed, speedOf(h, hu));
+      frontCell = std::max(frontCell, std::abs(hu) > frontThreshold_ ? i : IndexType(0));
+    }
+
+    const RealType scale = Graded ? RealType(1.0) : cellSize_;
+    diagnostics->combine({mass * scale, momentum * scale, maxHeight, maxSpeed, frontCell});
+  }
+}
+
+template <unsigned int NumTracers>
+void Blocks::BasicWavePropagationBlock<NumTracers>::setOutflowBoundaryConditions() {
   h_[0]         = h_[1];
   h_[size_ + 1] = h_[size_];
 
   hu_[0]         = hu_[1];
   hu_[size_ + 1] = hu_[size_];
+
+  for (RealType* hc : tracers_) {
+    hc[0]         = hc[1];
+    hc[size_ + 1] = hc[size_];
+  }
+}
+
+template <unsigned int NumTracers>
+void Blocks::BasicWavePropagationBlock<NumTracers>::setBoundaryConditions(BoundaryCondition* left, BoundaryCondition* right) {
+  leftBoundary_  = left;
+  rightBoundary_ = right;
+}
+
+template <unsigned int NumTracers>
+void Blocks::BasicWavePropagationBlock<NumTracers>::applyBoundaryConditions(double time) {
+  applyBoundaryCondition(BoundaryCondition::LEFT, time);
+  applyBoundaryCondition(BoundaryCondition::RIGHT, time);
+}
+
+template <unsigned int NumTracers>
+void Blocks::BasicWavePropagationBlock<NumTracers>::applyBoundaryCondition(BoundaryCondition::Side side, double time) {
+  if (side == BoundaryCondition::LEFT) {
+    if (leftBoundary_) {
+      leftBoundary_->apply(BoundaryCondition::LEFT, h_, hu_, size_, time);
+    } else {
+      h_[0]  = h_[1];
+      hu_[0] = hu_[1];
+    }
+  } else {
+    if (rightBoundary_) {
+      rightBoundary_->apply(BoundaryCondition::RIGHT, h_, hu_, size_, time);
+    } else {
+      h_[size_ + 1]  = h_[size_];
+      hu_[size_ + 1] = hu_[size_];
+    }
+  }
+
+  // The tracer ghost cells may depend on the new water height
+  BoundaryCondition* boundary = side == BoundaryCondition::LEFT ? leftBoundary_ : rightBoundary_;
+  for (RealType* hc : tracers_) {
+    if (boundary) {
+      boundary->applyTracer(side, h_, hc, size_, time);
+    } else if (side == BoundaryCondition::LEFT) {
+      hc[0] = hc[1];
+    } else {
+      hc[size_ + 1] = hc[size_];
+    }
+  }
+}
+
+template <unsigned int NumTracers>
+void Blocks::BasicWavePropagationBlock<NumTracers>::setDiagnosticsEnabled(bool enabled, RealType frontThreshold) {
+  diagnosticsEnabled_ = enabled;
+  frontThreshold_     = frontThreshold;
 }
+
+template <unsigned int NumTracers>
+bool Blocks::BasicWavePropagationBlock<NumTracers>::isDiagnosticsEnabled() const { return diagnosticsEnabled_; }
+
+template <unsigned int NumTracers>
+const Blocks::Diagnostics& Blocks::BasicWavePropagationBlock<NumTracers>::getDiagnostics() const { return diagnostics_; }
+
+template <unsigned int NumTracers>
+void Blocks::BasicWavePropagationBlock<NumTracers>::setEnvelopeEnabled(bool enabled) {
+  envelopeEnabled_ = enabled;
+
+  if (enabled) {
+    envelope_.maxDepth.assign(h_, h_ + size_ + 2);
+    envelope_.maxSpeed.resize(size_ + 2);
+    for (IndexType i = 0; i < size_ + 2; i++) {
+      envelope_.maxSpeed[i] = speedOf(h_[i], hu_[i]);
+    }
+    envelope_.arrivalTime.assign(size_ + 2, RealType(-1.0));
+  } else {
+    envelope_ = Envelope();
+  }
+}
+
+template <unsigned int NumTracers>
+bool Blocks::BasicWavePropagationBlock<NumTracers>::isEnvelopeEnabled() const { return envelopeEnabled_; }
+
+template <unsigned int NumTracers>
+const Blocks::Envelope& Blocks::BasicWavePropagationBlock<NumTracers>::getEnvelope() const { return envelope_; }
+
+template <unsigned int NumTracers>
+RealType Blocks::BasicWavePropagationBlock<NumTracers>::getCellSize() const { return cellSize_; }
+
+template <unsigned int NumTracers>
+void Blocks::BasicWavePropagationBlock<NumTracers>::setCellSizes(const RealType* cellSizes) {
+  if (cellSizes == nullptr) {
+    cellSizes_.clear();
+    inverseCellSizes_.clear();
+    return;
+  }
+
+  // The ghost cells are as wide as their neighbours
+  cellSizes_.resize(size_ + 2);
+  std::copy(cellSizes, cellSizes + size_, cellSizes_.begin() + 1);
+  cellSizes_[0]         = cellSizes_[1];
+  cellSizes_[size_ + 1] = cellSizes_[size_];
+
+  inverseCellSizes_.resize(size_ + 2);
+  for (IndexType i = 0; i < size_ + 2; i++) {
+    inverseCellSizes_[i] = RealType(1.0) / cellSizes_[i];
+  }
+}
+
+template <unsigned int NumTracers>
+bool Blocks::BasicWavePropagationBlock<NumTracers>::isUniform() const { return cellSizes_.empty(); }
+
+template <unsigned int NumTracers>
+const std::vector<RealType>& Blocks::BasicWavePropagationBlock<NumTracers>::getCellSizes() const { return cellSizes_; }
+
+template <unsigned int NumTracers>
+void Blocks::BasicWavePropagationBlock<NumTracers>::setUnknowns(RealType* h, RealType* hu, const std::array<RealType*, NumTracers>& tracers) {
+  h_       = h;
+  hu_      = hu;
+  tracers_ = tracers;
+}
+
+template <unsigned int NumTracers>
+void Blocks::BasicWavePropagationBlock<NumTracers>::setFriction(FrictionLaw law, RealType coefficient) {
+  frictionLaw_ = law;
+  frictionCoefficients_.assign(size_ + 2, coefficient);
+}
+
+template <unsigned int NumTracers>
+void Blocks::BasicWavePropagationBlock<NumTracers>::setFriction(FrictionLaw law, const RealType* coefficients) {
+  frictionLaw_ = law;
+  frictionCoefficients_.assign(size_ + 2, RealType(0.0));
+  std::copy(coefficients, coefficients + size_, frictionCoefficients_.begin() + 1);
+}
+
+template <unsigned int NumTracers>
+Blocks::WavePropagationBlockBase::FrictionLaw Blocks::BasicWavePropagationBlock<NumTracers>::getFrictionLaw() const { return frictionLaw_; }
+
+template class Blocks::BasicWavePropagationBlock<0>;
+template class Blocks::BasicWavePropagationBlock<1>;
+template class Blocks::BasicWavePropagationBlock<2>;
@@ -36,12 +36,29 @@
 
 #pragma once
 
+#include <array>
+#include <vector>
+
 #include "FWaveSolver.hpp"
 
+#include "Blocks/BoundaryConditions.hpp"
+#include "Blocks/Diagnostics.hpp"
+#include "Blocks/Envelope.hpp"
+#include "SWE1DExport.hpp"
+#include "Tools/IndexType.hpp"
 #include "Tools/RealType.hpp"
 
 namespace Blocks {
 
+  /**
+   * Types shared by all wave propagation blocks
+   */
+  class SWE1D_EXPORT WavePropagationBlockBase {
+  public:
+    /** Bottom friction law, the coefficient is n for Manning and C for Chezy */
+    enum FrictionLaw { NO_FRICTION, MANNING, CHEZY };
+  };
+
   /**
    * Allocated variables:
    *   unknowns h,hu are defined on grid indices [0,..,n+1] (done by the caller)
@@ -68,11 +85,35 @@ namespace Blocks {
    *             or
    *    NetUpdatesRight(i-1)
    * </pre>
+   *
+   * In addition to h and hu, NumTracers passive tracers hc (e.g. pollutant
+   * or sediment concentrations c times h) are transported. Each tracer is a
+   * separate array like h. A tracer is transported with the mass fluxes
+   * of the f-wave solution that also update h (hu of a cell plus its h net
+   * update of the edge), times the upwind concentration of the edge, so
+   * tracers need no additional Riemann solve. Only the concentration is
+   * stored per edge, it is computed in the same loop as the net updates and
+   * applied in the same sweep as the update of h and hu. The mass fluxes of
+   * both sides of a wet/dry edge differ (the solver drops the updates of the
+   * dry side), but the concentration of the wet side is used for both, so a
+   * uniform concentration stays uniform next to a shoreline as well.
+   *
+   * The grid is uniform with cells of size cellSize unless per-cell widths
+   * are set with setCellSizes(). The inverse widths of a non-uniform grid are
+   * precomputed, so the update sweep multiplies instead of divides, and the
+   * wave speeds of the edges are scaled to cellSize (see
+   * computeNumericalFluxes()), so the CFL condition of the smallest
+   * dx/speed is reduced like the maximum wave speed of a uniform grid.
+   *
+   * Explicitly instantiated for 0, 1 and 2 tracers.
    */
-  class WavePropagationBlock {
+  template <unsigned int NumTracers>
+  class SWE1D_EXPORT BasicWavePropagationBlock: public WavePropagationBlockBase {
   private:
     RealType* h_;
     RealType* hu_;
+    /** Tracers hc (including ghost cells) */
+    std::array<RealType*, NumTracers> tracers_;
 
     RealType* hNetUpdatesLeft_;
     RealType* hNetUpdatesRight_;
@@ -80,20 +121,56 @@ namespace Blocks {
     RealType* huNetUpdatesLeft_;
     RealType* huNetUpdatesRight_;
 
-    unsigned int size_;
+    /** Upwind concentration of each tracer at the edges [0,..,n] */
+    std::array<RealType*, NumTracers> tracerConcentrations_;
+
+    IndexType size_;
 
     RealType cellSize_;
 
-    /** The solver used in computeNumericalFluxes */
-    Solvers::FWaveSolver<RealType> solver_;
+    /** Widths and inverse widths of the cells of a non-uniform grid (including ghost cells), empty if uniform */
+    std::vector<RealType> cellSizes_;
+    std::vector<RealType> inverseCellSizes_;
+
+    /** Boundary conditions (not owned), nullptr = outflow */
+    BoundaryCondition* leftBoundary_;
+    BoundaryCondition* rightBoundary_;
+
+    /** Compute diagnostics during updateUnknowns */
+    bool diagnosticsEnabled_;
+    /** Minimal |hu| of a cell to count as part of the moving water */
+    RealType frontThreshold_;
+    /** Diagnostics of the last call to updateUnknowns(dt) */
+    Diagnostics diagnostics_;
+
+    /** Update the envelope during updateUnknowns */
+    bool     envelopeEnabled_;
+    Envelope envelope_;
+
+    FrictionLaw frictionLaw_;
+    /** Friction coefficient of each cell (including ghost cells) */
+    std::vector<RealType> frictionCoefficients_;
+
+    template <bool ComputeDiagnostics, bool TrackEnvelope, FrictionLaw Friction, bool Graded>
+    void updateUnknownsKernel(RealType dt, IndexType begin, IndexType end, Diagnostics* diagnostics, RealType time);
+
+    template <bool ComputeDiagnostics, bool TrackEnvelope>
+    void updateUnknownsFriction(RealType dt, IndexType begin, IndexType end, Diagnostics* diagnostics, RealType time);
+
+    template <bool ComputeDiagnostics, bool TrackEnvelope, FrictionLaw Friction>
+    void updateUnknownsGrid(RealType dt, IndexType begin, IndexType end, Diagnostics* diagnostics, RealType time);
 
   public:
     /**
      * @param size Domain size (= number of cells) without ghost cells
      * @param cellSize Size of one cell
+     * @param tracers Tracers hc on grid indices [0,..,n+1] (required if NumTracers > 0)
      */
-    WavePropagationBlock(RealType* h, RealType* hu, unsigned int size, RealType cellSize);
-    ~WavePropagationBlock();
+    BasicWavePropagationBlock(RealType* h, RealType* hu, IndexType size, RealType cellSize, const std::array<RealType*, NumTracers>& tracers = {});
+    ~BasicWavePropagationBlock();
+
+    BasicWavePropagationBlock(const BasicWavePropagationBlock&)            = delete;
+    BasicWavePropagationBlock& operator=(const BasicWavePropagationBlock&) = delete;
 
     /**
      * Computes the net-updates from the unknowns
@@ -102,18 +179,166 @@ namespace Blocks {
      */
     RealType computeNumericalFluxes();
 
+    /**
+     * Computes the net-updates of the edges [begin,..,end-1] only
+     *
+     * Different ranges can be computed concurrently.
+     *
+     * @return The maximum wave speed of the range (on a non-uniform grid the
+     *  maximum of speed*cellSize/dx of the edges, i.e. the speed that would
+     *  give the same CFL condition on the uniform grid)
+     */
+    RealType computeNumericalFluxes(IndexType begin, IndexType end);
+
+    /**
+     * @return The maximum possible time step (CFL condition) for a wave speed
+     */
+    RealType getMaxTimeStep(RealType maxWaveSpeed) const;
+
+    /**
+     * @return Mass flux through the edge between the ghost cell and the inner
+     *  cell of a side (positive to the right), requires computed net updates
+     */
+    RealType getBoundaryMassFlux(BoundaryCondition::Side side) const;
+
+    /**
+     * Replaces the mass flux through the edge between the ghost cell and the
+     * inner cell of a side, e.g. by a flux shared with other blocks
+     *
+     * Only the net update of h into the inner cell is changed, so it has to
+     * be called after computeNumericalFluxes() and before updateUnknowns().
+     */
+    void setBoundaryMassFlux(BoundaryCondition::Side side, RealType flux);
+
     /**
      * Update the unknowns with the already computed net-updates
      *
      * @param dt Time step size
+     * @param time Time after the update (only used for the arrival times of the envelope)
+     */
+    void updateUnknowns(RealType dt, double time = 0.0);
+
+    /**
+     * Update the unknowns of the cells [begin,..,end-1] only
+     *
+     * Different ranges can be updated concurrently, the diagnostics of each
+     * range are reduced into the given (thread-local) object.
+     *
+     * @param diagnostics Partial diagnostics of the range, may be nullptr if
+     *  diagnostics are disabled
+     * @param time Time after the update (only used for the arrival times of the envelope)
      */
-    void updateUnknowns(RealType dt);
+    void updateUnknowns(RealType dt, IndexType begin, IndexType end, Diagnostics* diagnostics, double time = 0.0);
 
     /**
-     * Updates h and hu according to the outflow condition to both
+     * Enables or disables the computation of diagnostics in updateUnknowns
+     *
+     * @param frontThreshold Minimal |hu| of a cell to count as part of the moving water
+     */
+    void setDiagnosticsEnabled(bool enabled, RealType frontThreshold = RealType(1e-3));
+
+    bool isDiagnosticsEnabled() const;
+
+    /**
+     * @return Diagnostics of the unknowns after the last update
+     */
+    const Diagnostics& getDiagnostics() const;
+
+    /**
+     * Enables or disables the envelope, which is updated in the same sweep as
+     * the unknowns (no additional pass over the memory)
+     *
+     * Enabling resets the maxima to the current unknowns and clears the
+     * arrival times. The front threshold of the diagnostics is also the
+     * threshold of the arrival times.
+     */
+    void setEnvelopeEnabled(bool enabled);
+
+    bool isEnvelopeEnabled() const;
+
+    /**
+     * @return Envelope of all updates since it was enabled
+     */
+    const Envelope& getEnvelope() const;
+
+    RealType getCellSize() const;
+
+    /**
+     * Switches to a non-uniform grid
+     *
+     * The uniform cell size (getCellSize()) remains the reference of the
+     * wave speeds returned by computeNumericalFluxes().
+     *
+     * @param cellSizes Widths of the inner cells (size values), nullptr for the uniform grid
+     */
+    void setCellSizes(const RealType* cellSizes);
+
+    bool isUniform() const;
+
+    /**
+     * @return Widths of all cells (including ghost cells), empty if the grid is uniform
+     */
+    const std::vector<RealType>& getCellSizes() const;
+
+    /**
+     * Moves the block to other unknowns of the same size, e.g. a shifted
+     * window of a longer channel (the net updates are kept)
+     */
+    void setUnknowns(RealType* h, RealType* hu, const std::array<RealType*, NumTracers>& tracers = {});
+
+    /**
+     * Enables a bottom friction source term with the same coefficient in all cells
+     *
+     * The friction is integrated exactly (for a frozen water height) in the
+     * same sweep as the net updates: hu is divided by 1 + dt*k*|u|, with
+     * k = g*n^2/h^(4/3) for Manning and k = g/(C^2*h) for Chezy. This is
+     * stable for any time step, the CFL condition only depends on the wave
+     * speed.
+     */
+    void setFriction(FrictionLaw law, RealType coefficient);
+
+    /**
+     * Enables a bottom friction source term with per-cell coefficients
+     *
+     * @param coefficients Coefficients of the inner cells (size values)
+     */
+    void setFriction(FrictionLaw law, const RealType* coefficients);
+
+    FrictionLaw getFrictionLaw() const;
+
+    /**
+     * Updates h, hu and the tracers according to the outflow condition to both
      * boundaries
      */
     void setOutflowBoundaryConditions();
+
+    /**
+     * Selects the boundary conditions used by applyBoundaryConditions()
+     *
+     * @param left Boundary condition (not owned), nullptr for outflow
+     * @param right Boundary condition (not owned), nullptr for outflow
+     */
+    void setBoundaryConditions(BoundaryCondition* left, BoundaryCondition* right);
+
+    /**
+     * Updates the ghost cells according to the selected boundary conditions
+     *
+     * @param time Current time of the simulation (for time-dependent forcing)
+     */
+    void applyBoundaryConditions(double time);
+
+    /**
+     * Updates the ghost cell of one side only, e.g. by the thread that owns
+     * the cells next to it
+     */
+    void applyBoundaryCondition(BoundaryCondition::Side side, double time);
   };
 
+  extern template class BasicWavePropagationBlock<0>;
+  extern template class BasicWavePropagationBlock<1>;
+  extern template class BasicWavePropagationBlock<2>;
+
+  /** Shallow water block without tracers */
+  using WavePropagationBlock = BasicWavePropagationBlock<0>;
+
 } // namespace Blocks
\ No newline at end of file
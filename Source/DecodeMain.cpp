@@ -0,0 +1,77 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "Tools/CompressedReader.hpp"
+#include "Tools/Logger.hpp"
+#include "Tools/RealType.hpp"
+#include "Writers/VTKWriter.hpp"
+
+/**
+ * Converts a compressed output file back to VTK files
+ */
+int main(int argc, char** argv) {
+  if (argc < 2 || argc > 3) {
+    std::cerr << "Usage: SWE1D-Decode FILE [BASENAME]" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  Tools::CompressedReader reader(argv[1]);
+  Writers::VTKWriter      vtkWriter(argc > 2 ? argv[2] : "SWE1D_decoded", reader.getCellSize());
+
+  double                t;
+  std::vector<RealType> h, hu;
+  // The VTK writer expects a ghost cell layer
+  std::vector<RealType> hGhost, huGhost;
+  unsigned int          numFrames = 0;
+
+  while (reader.readFrame(t, h, hu)) {
+    hGhost.resize(h.size() + 2);
+    huGhost.resize(hu.size() + 2);
+    std::copy(h.begin(), h.end(), hGhost.begin() + 1);
+    std::copy(hu.begin(), hu.end(), huGhost.begin() + 1);
+
+    vtkWriter.write(t, hGhost.data(), huGhost.data(), h.size());
+    numFrames++;
+  }
+
+  Tools::Logger::logger << "Decoded " << numFrames << " frames" << std::endl;
+
+  return EXIT_SUCCESS;
+}
@@ -34,81 +34,259 @@
  * @author Sebastian Rettenberger <rettenbs@in.tum.de>
  */
 
-#include <cstring>
 #include <fenv.h>
 
-#include "Blocks/WavePropagationBlock.hpp"
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+#include "Blocks/BoundaryConditions.hpp"
+#include "Runners/MovingWindowSimulation.hpp"
+#include "Runners/OutOfCoreSimulation.hpp"
+#include "Runners/Simulation.hpp"
+#include "Runners/SimulationServer.hpp"
+#include "Runners/TaskGraphRunner.hpp"
+#include "Runners/ThreadPoolRunner.hpp"
 #include "Scenarios/DamBreakScenario.hpp"
 #include "Tools/Args.hpp"
 #include "Tools/Logger.hpp"
 #include "Tools/RealType.hpp"
+#include "Writers/CompressedWriter.hpp"
 #include "Writers/ConsoleWriter.hpp"
+#include "Writers/DiagnosticsWriter.hpp"
+#include "Writers/EnvelopeWriter.hpp"
+#include "Writers/ProbeWriter.hpp"
+#include "Writers/PyramidWriter.hpp"
+#include "Writers/SharedMemoryWriter.hpp"
 #include "Writers/VTKWriter.hpp"
 
-int main(int argc, char** argv) {
-  // Triggers signals on floating point errors, i.e. prohibits quiet NaNs and alike.
-  feenableexcept(FE_DIVBYZERO | FE_INVALID | FE_OVERFLOW);
+/**
+ * Sets up the boundary conditions and writers and runs the time steps on
+ * an in-memory (Runners::Simulation), out-of-core (Runners::OutOfCoreSimulation)
+ * or moving-window (Runners::MovingWindowSimulation) state
+ */
+template <class SimulationType>
+int run(Tools::Args& args, const Scenarios::Scenario& scenario, SimulationType& simulation) {
+  constexpr bool InMemory     = std::is_same_v<SimulationType, Runners::Simulation>;
+  constexpr bool MovingWindow = std::is_same_v<SimulationType, Runners::MovingWindowSimulation>;
 
-  // Parse command line parameters
-  Tools::Args args(argc, argv);
+  if (!InMemory && args.getExecutor() != Tools::Args::SEQUENTIAL) {
+    Tools::Logger::logger.error("The out-of-core and moving-window modes only support the sequential executor");
+  }
 
-  // Scenario
-  Scenarios::DamBreakScenario scenario(args.getSize());
+  if (MovingWindow && !args.getProbes().empty()) {
+    Tools::Logger::logger.error("Probes are not supported in the moving-window mode");
+  }
 
-  // Allocate memory
-  // Water height
-  RealType* h = new RealType[args.getSize() + 2];
-  // Momentum
-  RealType* hu = new RealType[args.getSize() + 2];
+  // Only the VTK files are placed at the current position of the window
+  if (MovingWindow && (args.getCompression() != Tools::Compression::NONE || args.getLevelOfDetail() != Tools::Args::NO_LOD || !args.getMonitor().empty())) {
+    Tools::Logger::logger.error("The moving-window mode only supports VTK field output (no compression, pyramid or monitor)");
+  }
 
-  // Initialize water height and momentum
-  for (unsigned int i = 0; i < args.getSize() + 2; i++) {
-    h[i] = scenario.getHeight(i);
+  if (!InMemory && !args.getEnvelopeFile().empty()) {
+    Tools::Logger::logger.error("The envelope is not supported in the out-of-core and moving-window modes");
+  }
+
+  if (!scenario.isUniform() && (!InMemory || !args.getProbes().empty())) {
+    Tools::Logger::logger.error("Graded grids are not supported in the out-of-core and moving-window modes or with probes");
+  }
+
+  // Boundary conditions
+  Blocks::BoundaryCondition* leftBoundary  = Blocks::BoundaryCondition::create(args.getLeftBoundary());
+  Blocks::BoundaryCondition* rightBoundary = Blocks::BoundaryCondition::create(args.getRightBoundary());
+  simulation.setBoundaryConditions(leftBoundary, rightBoundary);
+
+  // Bottom friction is applied in the update of the unknowns
+  if (args.getFrictionLaw() != Blocks::WavePropagationBlock::NO_FRICTION) {
+    if constexpr (InMemory) {
+      simulation.getBlock().setFriction(args.getFrictionLaw(), args.getFrictionCoefficient());
+    } else {
+      simulation.setFriction(args.getFrictionLaw(), args.getFrictionCoefficient());
+    }
+  }
+
+  // Periodic scan for NaN/Inf and negative water heights
+  simulation.setCheckInterval(args.getCheckInterval());
+
+  // Cell widths of a graded grid (empty if uniform) for the outputs with coordinates or totals,
+  // the compressed output and the pyramid only store the cell index and the mean cell size
+  std::vector<RealType> cellSizes;
+  if (!scenario.isUniform()) {
+    cellSizes.resize(simulation.getSize());
+    for (IndexType i = 0; i < simulation.getSize(); i++) {
+      cellSizes[i] = scenario.getCellWidth(i + 1);
+    }
   }
-  std::memset(hu, 0, sizeof(RealType) * (args.getSize() + 2));
 
   // Create a writer that is responsible printing out values
   Writers::ConsoleWriter consoleWriter;
-  Writers::VTKWriter     vtkWriter("SWE1D", scenario.getCellSize());
+  Writers::VTKWriter     vtkWriter("SWE1D", scenario.getCellSize(), args.getVtkPieces());
+  if (!cellSizes.empty()) {
+    vtkWriter.setCellSizes(cellSizes.data(), simulation.getSize());
+  }
 
-  // Helper class computing the wave propagation
-  Blocks::WavePropagationBlock wavePropagation(h, hu, args.getSize(), scenario.getCellSize());
+  // Compressed field output replaces the VTK files (compression runs on a separate thread)
+  Writers::CompressedWriter* compressedWriter = nullptr;
+  if (args.getCompression() != Tools::Compression::NONE) {
+    compressedWriter = new Writers::CompressedWriter("SWE1D.swc", scenario.getCellSize(), args.getCompression(), args.getTolerance());
+  }
 
-  // Write initial data
-  Tools::Logger::logger.info("Initial data");
+  // Level-of-detail pyramid for browsing large runs
+  Writers::PyramidWriter* pyramidWriter = nullptr;
+  if (args.getLevelOfDetail() != Tools::Args::NO_LOD) {
+    pyramidWriter = new Writers::PyramidWriter("SWE1D.lod", scenario.getCellSize(), simulation.getSize(), args.getLevelOfDetail() == Tools::Args::LOD_FULL);
+  }
+
+  if (args.getOutputInterval() > 0) {
+    if (pyramidWriter) {
+      simulation.addWriter(*pyramidWriter, args.getOutputInterval());
+    }
+
+    // A full pyramid already contains the field
+    if (args.getLevelOfDetail() != Tools::Args::LOD_FULL) {
+      if (compressedWriter) {
+        simulation.addWriter(*compressedWriter, args.getOutputInterval());
+      } else {
+        simulation.addWriter(vtkWriter, args.getOutputInterval());
+      }
+    }
+  }
+  // simulation.addWriter(consoleWriter);
+
+  // Diagnostics are reduced during the update of the unknowns
+  Writers::DiagnosticsWriter* diagnosticsWriter = nullptr;
+  if (!args.getDiagnosticsFile().empty()) {
+    diagnosticsWriter = new Writers::DiagnosticsWriter(args.getDiagnosticsFile(), scenario.getCellSize());
+    if (!cellSizes.empty()) {
+      diagnosticsWriter->setCellSizes(cellSizes.data(), simulation.getSize());
+    }
+    simulation.setDiagnosticsWriter(diagnosticsWriter);
+  }
 
-  // Current time of simulation
-  double t = 0;
+  // Maximum depth, speed and arrival time per cell, accumulated during the update of the unknowns
+  Writers::EnvelopeWriter* envelopeWriter = nullptr;
+  if constexpr (InMemory) {
+    if (!args.getEnvelopeFile().empty()) {
+      envelopeWriter = new Writers::EnvelopeWriter(args.getEnvelopeFile(), scenario.getCellSize());
+      if (!cellSizes.empty()) {
+        envelopeWriter->setCellSizes(cellSizes.data(), simulation.getSize());
+      }
+      simulation.setEnvelopeWriter(envelopeWriter, args.getEnvelopeInterval());
+    }
+  }
 
-  // consoleWriter.write(h, hu, args.getSize());
-  vtkWriter.write(t, h, hu, args.getSize());
+  // Time series at the gauge positions
+  Writers::ProbeWriter* probeWriter = nullptr;
+  if (!args.getProbes().empty()) {
+    probeWriter = new Writers::ProbeWriter(args.getProbeFile(), args.getProbes(), scenario.getCellSize(), args.getSize(), args.getProbeInterpolation());
+    simulation.addWriter(*probeWriter);
+  }
 
-  for (unsigned int i = 0; i < args.getTimeSteps(); i++) {
-    // Do one time step
+  // Live monitoring, readers never block the simulation
+  Writers::SharedMemoryWriter* monitorWriter = nullptr;
+  if (!args.getMonitor().empty()) {
+    monitorWriter = new Writers::SharedMemoryWriter(args.getMonitor(), scenario.getCellSize(), simulation.getSize());
+    if (!cellSizes.empty()) {
+      monitorWriter->setCellSizes(cellSizes.data(), simulation.getSize());
+    }
+    simulation.addWriter(*monitorWriter, args.getMonitorInterval());
+  }
 
-    // Update boundaries
-    wavePropagation.setOutflowBoundaryConditions();
+  // Cells leaving the moving window, every frame continues the channel
+  Writers::CompressedWriter* trailWriter = nullptr;
+  if constexpr (MovingWindow) {
+    if (!args.getTrailFile().empty()) {
+      trailWriter = new Writers::CompressedWriter(args.getTrailFile(), scenario.getCellSize(), Tools::Compression::LOSSLESS);
+      simulation.setTrailWriter(trailWriter);
+    }
+  }
+
+  // Write initial data
+  Tools::Logger::logger.info("Initial data");
+  simulation.writeOutput();
 
-    // Compute numerical flux on each edge
-    RealType maxTimeStep = wavePropagation.computeNumericalFluxes();
+  if constexpr (InMemory) {
+    if (args.getExecutor() == Tools::Args::TASKGRAPH) {
+      // Pipelined steps, the output overlaps with the following steps
+      Runners::TaskGraphRunner runner(simulation, args.getNumThreads(), args.getChunkSize());
+      runner.run(args.getTimeSteps());
+    } else if (args.getExecutor() == Tools::Args::POOL) {
+      // One slice per thread, no global barriers except for the output
+      Runners::ThreadPoolRunner runner(simulation, args.getNumThreads());
+      runner.run(args.getTimeSteps());
+    }
+  }
 
-    // Update unknowns from net updates
-    wavePropagation.updateUnknowns(maxTimeStep);
+  if (args.getExecutor() == Tools::Args::SEQUENTIAL) {
+    for (unsigned int i = 0; i < args.getTimeSteps(); i++) {
+      // Current time of simulation
+      const double t = simulation.getTime();
 
-    Tools::Logger::logger
-      << "Computing iteration " << i << " at time " << t << " with max. timestep " << maxTimeStep << std::endl;
+      // Do one time step
+      RealType maxTimeStep = simulation.step();
 
-    // Update time
-    t += maxTimeStep;
+      Tools::Logger::logger
+        << "Computing iteration " << i << " at time " << t << " with max. timestep " << maxTimeStep << std::endl;
+    }
+  }
 
-    // Write new values
-    // consoleWriter.write(h, hu, args.getSize());
-    vtkWriter.write(t, h, hu, args.getSize());
+  if constexpr (InMemory) {
+    simulation.writeEnvelope();
   }
 
   // Free allocated memory
-  delete[] h;
-  delete[] hu;
+  delete compressedWriter;
+  delete trailWriter;
+  delete pyramidWriter;
+  delete probeWriter;
+  delete monitorWriter;
+  delete diagnosticsWriter;
+  delete envelopeWriter;
+  delete leftBoundary;
+  delete rightBoundary;
 
   return EXIT_SUCCESS;
 }
+
+int main(int argc, char** argv) {
+  // Parse command line parameters
+  Tools::Args args(argc, argv);
+
+  if (args.getFpTraps()) {
+    // Triggers signals on floating point errors, i.e. prohibits quiet NaNs and alike.
+    // Only meant for debugging, as it prevents vectorized and speculative code paths.
+    feenableexcept(FE_DIVBYZERO | FE_INVALID | FE_OVERFLOW);
+  }
+
+  if (!args.getServer().empty()) {
+    if (args.getGrading() != RealType(1)) {
+      Tools::Logger::logger.error("Graded grids are not supported in the server mode");
+    }
+
+    // Serves run requests until a SHUTDOWN request arrives
+    Runners::SimulationServer server(args.getServer(), args.getNumThreads(), args.getSize());
+    server.run();
+    return EXIT_SUCCESS;
+  }
+
+  // Scenario
+  Scenarios::DamBreakScenario scenario(args.getSize(), RealType(15), RealType(10), args.getGrading());
+
+  if (!args.getOutOfCoreFile().empty()) {
+    // Water height and momentum in a memory-mapped file, processed chunk by chunk
+    Runners::OutOfCoreSimulation simulation(scenario, args.getSize(), args.getOutOfCoreFile(), args.getChunkSize());
+    return run(args, scenario, simulation);
+  }
+
+  if (args.getWindowSize() > 0) {
+    // Only the cells around the front are stored, the dam starts in the first quarter of the window
+    const IndexType windowSize  = std::min(args.getWindowSize(), args.getSize());
+    const IndexType windowBegin = args.getSize() / 2 - std::min(windowSize / 4, args.getSize() / 2);
+    Runners::MovingWindowSimulation simulation(scenario, args.getSize(), windowSize, windowBegin);
+    return run(args, scenario, simulation);
+  }
+
+  // Allocates and initializes water height and momentum
+  Runners::Simulation simulation(scenario, args.getSize());
+  return run(args, scenario, simulation);
+}
@@ -0,0 +1,92 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include "Tools/Logger.hpp"
+#include "Tools/RealType.hpp"
+#include "Tools/SharedMemoryReader.hpp"
+
+/**
+ * Prints the frames published by a running simulation (--monitor=NAME)
+ */
+int main(int argc, char** argv) {
+  if (argc < 2 || argc > 3) {
+    std::cerr << "Usage: SWE1D-Monitor NAME [NUM_FRAMES]" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  const std::uint64_t numFrames = argc > 2 ? std::stoull(argv[2]) : 0;
+
+  Tools::SharedMemoryReader       reader(argv[1]);
+  Tools::SharedMemoryReader::Frame frame;
+
+  // Water height profile with one character per column
+  constexpr unsigned int NumColumns = 64;
+  const char             levels[]   = " .:-=+*#%@";
+
+  std::uint64_t numPrinted = 0;
+  std::uint64_t lastFrame  = 0;
+
+  while (numFrames == 0 || numPrinted < numFrames) {
+    // Only poll, the simulation is never blocked
+    if (reader.getNumFrames() == lastFrame || !reader.readLatest(frame)) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+      continue;
+    }
+    lastFrame = frame.number + 1;
+
+    Tools::Logger::logger
+      << "Frame " << frame.number << " at time " << frame.time << ": mass " << frame.mass << ", momentum " << frame.momentum << ", max. height "
+      << frame.maxHeight << ", max. speed " << frame.maxSpeed << std::endl;
+
+    std::string profile(std::min<std::size_t>(NumColumns, frame.h.size()), ' ');
+    for (std::size_t c = 0; c < profile.size(); c++) {
+      const RealType h     = frame.h[c * frame.h.size() / profile.size()];
+      const RealType level = frame.maxHeight > 0 ? h / static_cast<RealType>(frame.maxHeight) : 0;
+      profile[c]           = levels[std::clamp(static_cast<int>(level * 9), 0, 9)];
+    }
+    std::cout << "|" << profile << "|" << std::endl;
+
+    numPrinted++;
+  }
+
+  return EXIT_SUCCESS;
+}
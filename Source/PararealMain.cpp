@@ -0,0 +1,175 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <getopt.h>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include "Blocks/BoundaryConditions.hpp"
+#include "Runners/PararealRunner.hpp"
+#include "Scenarios/DamBreakScenario.hpp"
+#include "Tools/IndexType.hpp"
+#include "Tools/Logger.hpp"
+
+namespace {
+
+  void printHelpMessage(std::ostream& out) {
+    out
+      << "Usage: SWE1D-Parareal [OPTIONS...]" << std::endl
+      << "  -s, --size=SIZE              domain size of the fine propagator (default 10000)" << std::endl
+      << "  -T, --end-time=T             simulated time (default 10)" << std::endl
+      << "  -n, --slices=N               number of time slices (default: number of cores)" << std::endl
+      << "  -c, --coarsening=R           fine cells per cell of the coarse propagator (default 4)" << std::endl
+      << "  -k, --iterations=K           maximum number of iterations (default: number of slices)" << std::endl
+      << "  -e, --tolerance=TOL          stop if h and hu change by at most TOL at all slice ends (default 1e-6)" << std::endl
+      << "  -j, --threads=N              threads for the fine propagators (0 = all cores, default)" << std::endl
+      << "  -l, --left-boundary=TYPE     outflow (default), reflective or periodic" << std::endl
+      << "  -r, --right-boundary=TYPE    outflow (default), reflective or periodic" << std::endl
+      << "  -h, --help                   this help message" << std::endl;
+  }
+
+  Blocks::BoundaryCondition* createBoundary(const std::string& description) {
+    // The propagators revisit earlier times, which a streamed time series does not support
+    if (description.starts_with("inflow:")) {
+      Tools::Logger::logger.error("Parareal does not support inflow boundaries");
+    }
+
+    return Blocks::BoundaryCondition::create(description);
+  }
+
+} // namespace
+
+/**
+ * Runs the serial fine solution and Parareal on the dam break and reports
+ * the convergence of each iteration and the speedup
+ */
+int main(int argc, char** argv) {
+  IndexType    size          = 10000;
+  double       endTime       = 10;
+  unsigned int numSlices     = std::max(std::thread::hardware_concurrency(), 1u);
+  unsigned int coarsening    = 4;
+  unsigned int maxIterations = 0;
+  double       tolerance     = 1e-6;
+  unsigned int numThreads    = 0;
+  std::string  leftBoundary  = "outflow";
+  std::string  rightBoundary = "outflow";
+
+  const struct option longOptions[] = {
+    {"size", required_argument, 0, 's'},
+    {"end-time", required_argument, 0, 'T'},
+    {"slices", required_argument, 0, 'n'},
+    {"coarsening", required_argument, 0, 'c'},
+    {"iterations", required_argument, 0, 'k'},
+    {"tolerance", required_argument, 0, 'e'},
+    {"threads", required_argument, 0, 'j'},
+    {"left-boundary", required_argument, 0, 'l'},
+    {"right-boundary", required_argument, 0, 'r'},
+    {"help", no_argument, 0, 'h'},
+    {0, 0, 0, 0}};
+
+  int c, optionIndex;
+  while ((c = getopt_long(argc, argv, "s:T:n:c:k:e:j:l:r:h", longOptions, &optionIndex)) >= 0) {
+    switch (c) {
+    case 's':
+      size = static_cast<IndexType>(std::stoull(optarg));
+      break;
+    case 'T':
+      endTime = std::stod(optarg);
+      break;
+    case 'n':
+      numSlices = static_cast<unsigned int>(std::stoul(optarg));
+      break;
+    case 'c':
+      coarsening = static_cast<unsigned int>(std::stoul(optarg));
+      break;
+    case 'k':
+      maxIterations = static_cast<unsigned int>(std::stoul(optarg));
+      break;
+    case 'e':
+      tolerance = std::stod(optarg);
+      break;
+    case 'j':
+      numThreads = static_cast<unsigned int>(std::stoul(optarg));
+      break;
+    case 'l':
+      leftBoundary = optarg;
+      break;
+    case 'r':
+      rightBoundary = optarg;
+      break;
+    case 'h':
+      printHelpMessage(std::cout);
+      return EXIT_SUCCESS;
+    default:
+      printHelpMessage(std::cerr);
+      return EXIT_FAILURE;
+    }
+  }
+
+  Scenarios::DamBreakScenario scenario(size);
+  Runners::PararealRunner     parareal(scenario, size, numSlices, coarsening, numThreads);
+
+  Blocks::BoundaryCondition* left  = createBoundary(leftBoundary);
+  Blocks::BoundaryCondition* right = createBoundary(rightBoundary);
+  parareal.setBoundaryConditions(left, right);
+
+  Tools::Logger::logger << "Serial fine solution: " << size << " cells up to time " << endTime << std::endl;
+  const double serialSeconds = parareal.runSerial(endTime);
+  Tools::Logger::logger << "Serial time: " << serialSeconds << " s" << std::endl;
+
+  Tools::Logger::logger
+    << "Parareal: " << parareal.getNumSlices() << " slices, " << parareal.getNumThreads() << " threads, coarsening " << coarsening << std::endl;
+  const unsigned int numIterations = parareal.run(endTime, maxIterations > 0 ? maxIterations : parareal.getNumSlices(), tolerance);
+
+  for (unsigned int k = 0; k < numIterations; k++) {
+    const Runners::PararealRunner::Iteration& iteration = parareal.getIterations()[k];
+    Tools::Logger::logger
+      << "Iteration " << k + 1 << ": max. update " << iteration.maxUpdate << ", max. error " << iteration.maxError << ", time " << iteration.seconds
+      << " s, speedup " << serialSeconds / iteration.seconds << std::endl;
+  }
+
+  const double pararealSeconds = numIterations > 0 ? parareal.getIterations().back().seconds : 0;
+  Tools::Logger::logger
+    << "Parareal time: " << pararealSeconds << " s after " << numIterations << " iterations, speedup " << serialSeconds / pararealSeconds
+    << ", parallel efficiency " << serialSeconds / pararealSeconds / parareal.getNumThreads() << std::endl;
+
+  delete left;
+  delete right;
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,199 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#include "MovingWindowSimulation.hpp"
+
+#include <algorithm>
+
+Runners::MovingWindowSimulation::MovingWindowSimulation(
+  const Scenarios::Scenario& scenario, IndexType channelSize, IndexType windowSize, IndexType windowBegin, IndexType shiftSize
+):
+  scenario_(scenario),
+  channelSize_(channelSize),
+  size_(std::max<IndexType>(std::min(windowSize, channelSize), 1)),
+  shiftSize_(std::clamp<IndexType>(shiftSize == 0 ? size_ / 4 : shiftSize, 1, size_)),
+  windowBegin_(std::min(windowBegin, channelSize_ - size_)),
+  hBuffer_(2 * size_ + 2),
+  huBuffer_(2 * size_ + 2),
+  bufferBegin_(0),
+  h_(hBuffer_.data()),
+  hu_(huBuffer_.data()),
+  block_(h_, hu_, size_, scenario.getCellSize()),
+  leftBoundary_(nullptr),
+  rightBoundary_(nullptr),
+  time_(0),
+  step_(0),
+  trailWriter_(nullptr),
+  diagnosticsWriter_(nullptr),
+  healthCheck_(0) {
+
+  // Initialize the window only, the rest of the channel is never stored
+  for (IndexType i = 0; i < size_ + 2; i++) {
+    h_[i]  = scenario_.getHeight(windowBegin_ + i);
+    hu_[i] = scenario_.getMomentum(windowBegin_ + i);
+  }
+
+  // The front is needed to move the window
+  block_.setDiagnosticsEnabled(true);
+}
+
+void Runners::MovingWindowSimulation::addWriter(Writers::Writer& writer, unsigned int interval) { writers_.push_back({&writer, std::max(interval, 1u)}); }
+
+void Runners::MovingWindowSimulation::setTrailWriter(Writers::Writer* writer) { trailWriter_ = writer; }
+
+void Runners::MovingWindowSimulation::setDiagnosticsWriter(Writers::DiagnosticsWriter* writer) { diagnosticsWriter_ = writer; }
+
+void Runners::MovingWindowSimulation::setCheckInterval(unsigned int interval) { healthCheck_ = Tools::HealthCheck(interval); }
+
+void Runners::MovingWindowSimulation::setBoundaryConditions(Blocks::BoundaryCondition* left, Blocks::BoundaryCondition* right) {
+  leftBoundary_  = left;
+  rightBoundary_ = right;
+}
+
+void Runners::MovingWindowSimulation::setFriction(Blocks::WavePropagationBlock::FrictionLaw law, RealType coefficient) { block_.setFriction(law, coefficient); }
+
+void Runners::MovingWindowSimulation::writeOutput() {
+  for (const WriterEntry& entry : writers_) {
+    entry.writer->setOrigin(RealType(windowBegin_) * block_.getCellSize());
+    entry.writer->write(time_, h_, hu_, size_);
+  }
+}
+
+void Runners::MovingWindowSimulation::applyBoundaryConditions() {
+  if (windowBegin_ == 0 && leftBoundary_) {
+    leftBoundary_->apply(Blocks::BoundaryCondition::LEFT, h_, hu_, size_, time_);
+  } else {
+    // Also used behind the front, where the water is (nearly) constant
+    h_[0]  = h_[1];
+    hu_[0] = hu_[1];
+  }
+
+  if (windowBegin_ + size_ == channelSize_) {
+    if (rightBoundary_) {
+      rightBoundary_->apply(Blocks::BoundaryCondition::RIGHT, h_, hu_, size_, time_);
+    } else {
+      h_[size_ + 1]  = h_[size_];
+      hu_[size_ + 1] = hu_[size_];
+    }
+  }
+  // Otherwise the ghost cell keeps the initial values of the next channel cell
+}
+
+void Runners::MovingWindowSimulation::shift(IndexType numCells) {
+  if (trailWriter_) {
+    trailWriter_->write(time_, h_, hu_, numCells);
+  }
+
+  IndexType newBegin = bufferBegin_ + numCells;
+  if (newBegin + size_ + 2 > hBuffer_.size()) {
+    // End of the buffer, copy the remaining cells to its beginning
+    std::copy(hBuffer_.begin() + newBegin, hBuffer_.begin() + bufferBegin_ + size_ + 1, hBuffer_.begin());
+    std::copy(huBuffer_.begin() + newBegin, huBuffer_.begin() + bufferBegin_ + size_ + 1, huBuffer_.begin());
+    newBegin = 0;
+  }
+
+  bufferBegin_ = newBegin;
+  windowBegin_ += numCells;
+  h_  = hBuffer_.data() + bufferBegin_;
+  hu_ = huBuffer_.data() + bufferBegin_;
+
+  // Entering cells and the new right ghost cell
+  for (IndexType i = size_ + 1 - numCells; i < size_ + 2; i++) {
+    h_[i]  = scenario_.getHeight(windowBegin_ + i);
+    hu_[i] = scenario_.getMomentum(windowBegin_ + i);
+  }
+
+  block_.setUnknowns(h_, hu_);
+}
+
+RealType Runners::MovingWindowSimulation::step(RealType maxTimeStep) {
+  // Update boundaries
+  applyBoundaryConditions();
+
+  // Compute numerical flux on each edge of the window
+  const RealType dt = std::min(block_.computeNumericalFluxes(), maxTimeStep);
+
+  // Update unknowns from net updates
+  block_.updateUnknowns(dt);
+
+  time_ += dt;
+  step_++;
+
+  // Abort with diagnostics if the solution became unphysical
+  healthCheck_.check(step_, time_, h_, hu_, size_);
+
+  const IndexType frontCell = block_.getDiagnostics().frontCell;
+
+  if (diagnosticsWriter_) {
+    Blocks::Diagnostics diagnostics = block_.getDiagnostics();
+    if (diagnostics.frontCell > 0) {
+      diagnostics.frontCell += windowBegin_;
+    }
+    diagnosticsWriter_->write(step_, time_, diagnostics);
+  }
+
+  for (const WriterEntry& entry : writers_) {
+    if (step_ % entry.interval == 0) {
+      entry.writer->setOrigin(RealType(windowBegin_) * block_.getCellSize());
+      entry.writer->write(time_, h_, hu_, size_);
+    }
+  }
+
+  // Follow the front once it reaches the last shiftSize cells
+  const IndexType remaining = channelSize_ - windowBegin_ - size_;
+  if (remaining > 0 && frontCell + shiftSize_ > size_) {
+    shift(std::min(shiftSize_, remaining));
+  }
+
+  return dt;
+}
+
+double Runners::MovingWindowSimulation::getTime() const { return time_; }
+
+unsigned int Runners::MovingWindowSimulation::getStep() const { return step_; }
+
+IndexType Runners::MovingWindowSimulation::getSize() const { return size_; }
+
+IndexType Runners::MovingWindowSimulation::getChannelSize() const { return channelSize_; }
+
+IndexType Runners::MovingWindowSimulation::getShiftSize() const { return shiftSize_; }
+
+IndexType Runners::MovingWindowSimulation::getWindowBegin() const { return windowBegin_; }
+
+RealType Runners::MovingWindowSimulation::getCellSize() const { return block_.getCellSize(); }
+
+std::span<const RealType> Runners::MovingWindowSimulation::getHeight() const { return {h_ + 1, size_}; }
+
+std::span<const RealType> Runners::MovingWindowSimulation::getMomentum() const { return {hu_ + 1, size_}; }
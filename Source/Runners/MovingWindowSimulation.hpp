@@ -0,0 +1,234 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#pragma once
+
+#include <limits>
+#include <span>
+#include <vector>
+
+#include "Blocks/BoundaryConditions.hpp"
+#include "Blocks/WavePropagationBlock.hpp"
+#include "Scenarios/Scenario.hpp"
+#include "SWE1DExport.hpp"
+#include "Tools/HealthCheck.hpp"
+#include "Tools/IndexType.hpp"
+#include "Tools/RealType.hpp"
+#include "Writers/DiagnosticsWriter.hpp"
+#include "Writers/Writer.hpp"
+
+namespace Runners {
+
+  /**
+   * A simulation of a fixed-size window of a long channel that follows the
+   * wave front to the right
+   *
+   * Only the cells of the window are stored and updated, so memory and cost
+   * per step do not depend on the length of the channel. Whenever the front
+   * (Blocks::Diagnostics::frontCell) enters the last shiftSize cells of the
+   * window, the window moves shiftSize cells to the right: the cells that
+   * leave on the left are passed to the trail writer and the cells that
+   * enter on the right are initialized from the scenario.
+   *
+   * The window lives in a buffer of twice its size, shifting only moves the
+   * start of the window. When the end of the buffer is reached, the window
+   * is copied back to the beginning, i.e. once every windowSize/shiftSize
+   * shifts.
+   *
+   * The channel boundary conditions are used while the window touches the
+   * respective end of the channel. Otherwise the left ghost cell is an
+   * outflow boundary and the right ghost cell holds the (undisturbed)
+   * initial values of the next channel cell. Periodic boundaries are only
+   * correct if the window covers the whole channel.
+   */
+  class SWE1D_EXPORT MovingWindowSimulation {
+  private:
+    struct WriterEntry {
+      Writers::Writer* writer;
+      /** Write every interval-th step */
+      unsigned int interval;
+    };
+
+    /** Provides the initial values of the entering cells (not owned) */
+    const Scenarios::Scenario& scenario_;
+
+    /** Number of cells of the whole channel */
+    IndexType channelSize_;
+    /** Number of cells of the window */
+    IndexType size_;
+    /** Number of cells the window moves at once */
+    IndexType shiftSize_;
+    /** Number of channel cells left of the window */
+    IndexType windowBegin_;
+
+    /** Buffers of 2 * size + 2 values, the window (including ghost cells) starts at bufferBegin_ */
+    std::vector<RealType> hBuffer_;
+    std::vector<RealType> huBuffer_;
+    IndexType             bufferBegin_;
+
+    /** Water height of the window (including ghost cells) */
+    RealType* h_;
+    /** Momentum of the window (including ghost cells) */
+    RealType* hu_;
+
+    Blocks::WavePropagationBlock block_;
+
+    /** Boundary conditions (not owned), nullptr = outflow */
+    Blocks::BoundaryCondition* leftBoundary_;
+    Blocks::BoundaryCondition* rightBoundary_;
+
+    /** Current time of simulation */
+    double time_;
+    /** Number of time steps done */
+    unsigned int step_;
+
+    std::vector<WriterEntry> writers_;
+
+    /** Receives the cells that leave the window (not owned) */
+    Writers::Writer* trailWriter_;
+
+    Writers::DiagnosticsWriter* diagnosticsWriter_;
+
+    Tools::HealthCheck healthCheck_;
+
+    void applyBoundaryConditions();
+
+    /**
+     * Moves the window numCells cells to the right
+     */
+    void shift(IndexType numCells);
+
+  public:
+    /**
+     * @param scenario Initial values of the channel, must outlive the simulation
+     * @param channelSize Number of cells of the whole channel
+     * @param windowSize Number of cells of the window
+     * @param windowBegin Number of channel cells left of the initial window
+     * @param shiftSize Number of cells the window moves at once (0 = windowSize/4)
+     */
+    MovingWindowSimulation(const Scenarios::Scenario& scenario, IndexType channelSize, IndexType windowSize, IndexType windowBegin = 0, IndexType shiftSize = 0);
+
+    MovingWindowSimulation(const MovingWindowSimulation&)            = delete;
+    MovingWindowSimulation& operator=(const MovingWindowSimulation&) = delete;
+
+    /**
+     * Adds a writer for the cells of the window that is called every interval-th step
+     *
+     * The origin of the writer is set to the left face of the window before every write.
+     */
+    void addWriter(Writers::Writer& writer, unsigned int interval = 1);
+
+    /**
+     * Streams the cells that leave the window to a writer
+     *
+     * Every call of Writer::write() gets the next piece of the channel (in
+     * the values [1,..,size]), starting with the cell windowBegin + 1.
+     *
+     * @param writer The writer (not owned) or nullptr to drop the cells
+     */
+    void setTrailWriter(Writers::Writer* writer);
+
+    /**
+     * Writes the diagnostics of the window after every step, the front cell
+     * is counted from the left end of the channel
+     *
+     * @param writer The writer or nullptr to disable the output
+     */
+    void setDiagnosticsWriter(Writers::DiagnosticsWriter* writer);
+
+    /**
+     * Enables the periodic scan for NaN/Inf and negative water heights
+     *
+     * Disabled by default: a failed check reports the bad cell and exits the
+     * process through Tools::Logger::error, so only standalone runs should
+     * enable it. Embedding code can scan the state itself with
+     * Tools::HealthCheck::scan() instead.
+     *
+     * @param interval Number of time steps between two health checks (0 = disabled)
+     */
+    void setCheckInterval(unsigned int interval);
+
+    /**
+     * @param left Boundary condition of the channel (not owned), nullptr for outflow
+     * @param right Boundary condition of the channel (not owned), nullptr for outflow
+     */
+    void setBoundaryConditions(Blocks::BoundaryCondition* left, Blocks::BoundaryCondition* right);
+
+    /**
+     * Sets a uniform bottom friction (per-cell coefficients would not move
+     * with the window)
+     */
+    void setFriction(Blocks::WavePropagationBlock::FrictionLaw law, RealType coefficient);
+
+    /**
+     * Writes the current window with all writers, e.g. the initial data
+     */
+    void writeOutput();
+
+    /**
+     * Does one time step and moves the window if the front approaches its
+     * right end
+     *
+     * @param maxTimeStep Upper bound for the time step (in addition to the CFL condition)
+     * @return The time step size
+     */
+    RealType step(RealType maxTimeStep = std::numeric_limits<RealType>::max());
+
+    double       getTime() const;
+    unsigned int getStep() const;
+    /**
+     * @return Number of cells of the window
+     */
+    IndexType getSize() const;
+    IndexType getChannelSize() const;
+    IndexType getShiftSize() const;
+    /**
+     * @return Number of channel cells left of the window
+     */
+    IndexType getWindowBegin() const;
+    RealType  getCellSize() const;
+
+    /**
+     * @return Water height of the inner cells of the window
+     */
+    std::span<const RealType> getHeight() const;
+
+    /**
+     * @return Momentum of the inner cells of the window
+     */
+    std::span<const RealType> getMomentum() const;
+  };
+
+} // namespace Runners
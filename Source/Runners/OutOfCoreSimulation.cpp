@@ -0,0 +1,278 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#include "OutOfCoreSimulation.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "Tools/Logger.hpp"
+
+Runners::OutOfCoreSimulation::OutOfCoreSimulation(const Scenarios::Scenario& scenario, IndexType size, const std::string& fileName, IndexType chunkSize):
+  size_(size),
+  chunkSize_(std::max<IndexType>(std::min(chunkSize, size), 1)),
+  fileName_(fileName),
+  memory_(nullptr),
+  memorySize_(2 * (size + 2) * sizeof(RealType)),
+  h_(nullptr),
+  hu_(nullptr),
+  chunkH_(chunkSize_ + 2),
+  chunkHu_(chunkSize_ + 2),
+  block_(chunkH_.data(), chunkHu_.data(), chunkSize_, scenario.getCellSize()),
+  leftBoundary_(nullptr),
+  rightBoundary_(nullptr),
+  time_(0),
+  step_(0),
+  maxWaveSpeed_(0),
+  maxWaveSpeedValid_(false),
+  diagnosticsWriter_(nullptr),
+  healthCheck_(0) {
+
+  const int fd = open(fileName_.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0644);
+  if (fd < 0) {
+    Tools::Logger::logger.error(("Could not create state file " + fileName_).c_str());
+  }
+
+  if (ftruncate(fd, static_cast<off_t>(memorySize_)) != 0) {
+    close(fd);
+    Tools::Logger::logger.error(("Could not resize state file " + fileName_).c_str());
+  }
+
+  memory_ = mmap(nullptr, memorySize_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (memory_ == MAP_FAILED) {
+    Tools::Logger::logger.error(("Could not map state file " + fileName_).c_str());
+  }
+
+  // All passes sweep from left to right
+  madvise(memory_, memorySize_, MADV_SEQUENTIAL);
+
+  h_  = static_cast<RealType*>(memory_);
+  hu_ = h_ + size_ + 2;
+
+  // Initialize water height and momentum, written chunks are released immediately
+  for (IndexType begin = 0; begin < size_ + 2; begin += chunkSize_) {
+    const IndexType end = std::min(begin + chunkSize_, size_ + 2);
+    for (IndexType i = begin; i < end; i++) {
+      h_[i]  = scenario.getHeight(i);
+      hu_[i] = scenario.getMomentum(i);
+    }
+    advise(begin, end, MADV_DONTNEED);
+  }
+}
+
+Runners::OutOfCoreSimulation::~OutOfCoreSimulation() {
+  // Dirty pages are written back by the kernel, the file stays
+  munmap(memory_, memorySize_);
+}
+
+void Runners::OutOfCoreSimulation::addWriter(Writers::Writer& writer, unsigned int interval) { writers_.push_back({&writer, std::max(interval, 1u)}); }
+
+void Runners::OutOfCoreSimulation::setDiagnosticsWriter(Writers::DiagnosticsWriter* writer) {
+  diagnosticsWriter_ = writer;
+  block_.setDiagnosticsEnabled(writer != nullptr);
+}
+
+void Runners::OutOfCoreSimulation::setCheckInterval(unsigned int interval) { healthCheck_ = Tools::HealthCheck(interval); }
+
+void Runners::OutOfCoreSimulation::setBoundaryConditions(Blocks::BoundaryCondition* left, Blocks::BoundaryCondition* right) {
+  leftBoundary_  = left;
+  rightBoundary_ = right;
+
+  // The ghost cells change the wave speeds of the boundary edges
+  maxWaveSpeedValid_ = false;
+}
+
+void Runners::OutOfCoreSimulation::setFriction(Blocks::WavePropagationBlock::FrictionLaw law, RealType coefficient) { block_.setFriction(law, coefficient); }
+
+void Runners::OutOfCoreSimulation::writeOutput() {
+  for (const WriterEntry& entry : writers_) {
+    entry.writer->write(time_, h_, hu_, size_);
+  }
+}
+
+void Runners::OutOfCoreSimulation::applyBoundaryConditions() {
+  if (leftBoundary_) {
+    leftBoundary_->apply(Blocks::BoundaryCondition::LEFT, h_, hu_, size_, time_);
+  } else {
+    h_[0]  = h_[1];
+    hu_[0] = hu_[1];
+  }
+
+  if (rightBoundary_) {
+    rightBoundary_->apply(Blocks::BoundaryCondition::RIGHT, h_, hu_, size_, time_);
+  } else {
+    h_[size_ + 1]  = h_[size_];
+    hu_[size_ + 1] = hu_[size_];
+  }
+}
+
+void Runners::OutOfCoreSimulation::loadChunk(IndexType begin, IndexType end) {
+  std::copy(h_ + begin - 1, h_ + end + 1, chunkH_.begin());
+  std::copy(hu_ + begin - 1, hu_ + end + 1, chunkHu_.begin());
+}
+
+void Runners::OutOfCoreSimulation::advise(IndexType begin, IndexType end, int advice) {
+  static const std::uintptr_t pageSize = static_cast<std::uintptr_t>(sysconf(_SC_PAGESIZE));
+
+  for (RealType* values : {h_, hu_}) {
+    // madvise requires a page-aligned start, pages shared with neighbouring cells are only refaulted
+    const std::uintptr_t first = reinterpret_cast<std::uintptr_t>(values + begin) / pageSize * pageSize;
+    const std::uintptr_t last  = reinterpret_cast<std::uintptr_t>(values + end);
+    if (last > first) {
+      madvise(reinterpret_cast<void*>(first), last - first, advice);
+    }
+  }
+}
+
+RealType Runners::OutOfCoreSimulation::computeMaxWaveSpeed() {
+  RealType maxWaveSpeed = RealType(0.0);
+
+  for (IndexType begin = 1; begin < size_ + 1; begin += chunkSize_) {
+    const IndexType end = std::min(begin + chunkSize_, size_ + 1);
+    advise(end, std::min(end + chunkSize_, size_ + 1) + 1, MADV_WILLNEED);
+
+    // The chunk includes the edges to both halo cells
+    loadChunk(begin, end);
+    maxWaveSpeed = std::max(maxWaveSpeed, block_.computeNumericalFluxes(0, end - begin + 1));
+  }
+
+  return maxWaveSpeed;
+}
+
+RealType Runners::OutOfCoreSimulation::step(RealType maxTimeStep) {
+  if (!maxWaveSpeedValid_) {
+    applyBoundaryConditions();
+    maxWaveSpeed_ = computeMaxWaveSpeed();
+  }
+
+  const RealType dt = std::min(block_.getMaxTimeStep(maxWaveSpeed_), maxTimeStep);
+
+  Blocks::Diagnostics diagnostics;
+  RealType            nextMaxWaveSpeed = RealType(0.0);
+
+  // Value of the last cell of the previous chunk before and after the update
+  RealType oldH  = h_[0];
+  RealType oldHu = hu_[0];
+  RealType newH  = h_[0];
+  RealType newHu = hu_[0];
+
+  // Cells left of this index have been released
+  IndexType released = 0;
+
+  for (IndexType begin = 1; begin < size_ + 1; begin += chunkSize_) {
+    const IndexType end    = std::min(begin + chunkSize_, size_ + 1);
+    const IndexType length = end - begin;
+
+    // The page faults of the next chunk overlap with the computation of this one
+    advise(end, std::min(end + chunkSize_, size_ + 1) + 1, MADV_WILLNEED);
+
+    // The left halo was already updated in the file
+    loadChunk(begin, end);
+    chunkH_[0]  = oldH;
+    chunkHu_[0] = oldHu;
+    oldH        = chunkH_[length];
+    oldHu       = chunkHu_[length];
+
+    block_.computeNumericalFluxes(0, length + 1);
+
+    Blocks::Diagnostics partial;
+    block_.updateUnknowns(dt, 1, length + 1, &partial);
+    if (partial.frontCell > 0) {
+      partial.frontCell += begin - 1;
+    }
+    diagnostics.combine(partial);
+
+    std::copy(chunkH_.begin() + 1, chunkH_.begin() + length + 1, h_ + begin);
+    std::copy(chunkHu_.begin() + 1, chunkHu_.begin() + length + 1, hu_ + begin);
+
+    // Wave speeds of the next step on the edges between updated cells, the
+    // right halo is updated with the next chunk, the boundary edges after the sweep
+    chunkH_[0]       = newH;
+    chunkHu_[0]      = newHu;
+    nextMaxWaveSpeed = std::max(nextMaxWaveSpeed, block_.computeNumericalFluxes(begin == 1 ? 1 : 0, length));
+    newH             = chunkH_[length];
+    newHu            = chunkHu_[length];
+
+    // Keeps the resident memory at a few chunks
+    advise(released, begin, MADV_DONTNEED);
+    released = begin;
+  }
+
+  time_ += dt;
+  step_++;
+
+  // Ghost cells of the next step and the wave speeds of the boundary edges
+  applyBoundaryConditions();
+  loadChunk(1, 1);
+  nextMaxWaveSpeed = std::max(nextMaxWaveSpeed, block_.computeNumericalFluxes(0, 1));
+  loadChunk(size_ + 1, size_ + 1);
+  nextMaxWaveSpeed = std::max(nextMaxWaveSpeed, block_.computeNumericalFluxes(0, 1));
+
+  maxWaveSpeed_      = nextMaxWaveSpeed;
+  maxWaveSpeedValid_ = true;
+
+  // Abort with diagnostics if the solution became unphysical
+  healthCheck_.check(step_, time_, h_, hu_, size_);
+
+  if (diagnosticsWriter_) {
+    diagnosticsWriter_->write(step_, time_, diagnostics);
+  }
+
+  for (const WriterEntry& entry : writers_) {
+    if (step_ % entry.interval == 0) {
+      entry.writer->write(time_, h_, hu_, size_);
+    }
+  }
+
+  return dt;
+}
+
+double Runners::OutOfCoreSimulation::getTime() const { return time_; }
+
+unsigned int Runners::OutOfCoreSimulation::getStep() const { return step_; }
+
+IndexType Runners::OutOfCoreSimulation::getSize() const { return size_; }
+
+IndexType Runners::OutOfCoreSimulation::getChunkSize() const { return chunkSize_; }
+
+RealType Runners::OutOfCoreSimulation::getCellSize() const { return block_.getCellSize(); }
+
+std::span<const RealType> Runners::OutOfCoreSimulation::getHeight() const { return {h_ + 1, size_}; }
+
+std::span<const RealType> Runners::OutOfCoreSimulation::getMomentum() const { return {hu_ + 1, size_}; }
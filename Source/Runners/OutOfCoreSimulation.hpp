@@ -0,0 +1,221 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#pragma once
+
+#include <limits>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "Blocks/BoundaryConditions.hpp"
+#include "Blocks/WavePropagationBlock.hpp"
+#include "Scenarios/Scenario.hpp"
+#include "SWE1DExport.hpp"
+#include "Tools/HealthCheck.hpp"
+#include "Tools/IndexType.hpp"
+#include "Tools/RealType.hpp"
+#include "Writers/DiagnosticsWriter.hpp"
+#include "Writers/Writer.hpp"
+
+namespace Runners {
+
+  /**
+   * A simulation of one channel whose unknowns live in a memory-mapped file
+   *
+   * Meant for domains that do not fit into memory. The unknowns are swept
+   * chunk by chunk: each chunk is copied together with one halo cell on
+   * either side into a small buffer, where the wave propagation block
+   * computes the fluxes and updates the cells, and is written back. The
+   * left halo holds the old value of the previous chunk's last cell, so the
+   * result is identical to Simulation. While a chunk is computed, the pages
+   * of the next chunk are prefetched and the pages of the finished chunks
+   * are released.
+   *
+   * The maximum wave speed of the next step is computed on the updated
+   * chunk while it is still in the buffer, so every step reads and writes
+   * the file exactly once (health checks and writers read it again).
+   *
+   * File layout (native endianness): h[size+2] | hu[size+2], i.e. the same
+   * arrays including ghost cells as in Simulation. The file is kept after
+   * the simulation ends.
+   */
+  class SWE1D_EXPORT OutOfCoreSimulation {
+  private:
+    struct WriterEntry {
+      Writers::Writer* writer;
+      /** Write every interval-th step */
+      unsigned int interval;
+    };
+
+    IndexType size_;
+    /** Number of cells per chunk */
+    IndexType chunkSize_;
+
+    std::string fileName_;
+    void*       memory_;
+    std::size_t memorySize_;
+
+    /** Water height (mapped, including ghost cells) */
+    RealType* h_;
+    /** Momentum (mapped, including ghost cells) */
+    RealType* hu_;
+
+    /** One chunk plus the halo cells */
+    std::vector<RealType> chunkH_;
+    std::vector<RealType> chunkHu_;
+
+    /** Works on the chunk buffers */
+    Blocks::WavePropagationBlock block_;
+
+    /** Boundary conditions (not owned), nullptr = outflow */
+    Blocks::BoundaryCondition* leftBoundary_;
+    Blocks::BoundaryCondition* rightBoundary_;
+
+    /** Current time of simulation */
+    double time_;
+    /** Number of time steps done */
+    unsigned int step_;
+
+    /** Maximum wave speed of the current state (invalid after a change of the boundary conditions) */
+    RealType maxWaveSpeed_;
+    bool     maxWaveSpeedValid_;
+
+    std::vector<WriterEntry> writers_;
+
+    Writers::DiagnosticsWriter* diagnosticsWriter_;
+
+    Tools::HealthCheck healthCheck_;
+
+    void applyBoundaryConditions();
+
+    /**
+     * Copies the cells [begin-1,..,end] into the chunk buffers
+     */
+    void loadChunk(IndexType begin, IndexType end);
+
+    /**
+     * Hints the kernel that the cells [begin,..,end-1] are needed soon (advice = MADV_WILLNEED)
+     * or not needed anymore (advice = MADV_DONTNEED)
+     */
+    void advise(IndexType begin, IndexType end, int advice);
+
+    /**
+     * Separate pass over all edges, only needed if the maximum wave speed of
+     * the current state is not known from the previous step
+     */
+    RealType computeMaxWaveSpeed();
+
+  public:
+    /**
+     * Creates (or overwrites) the state file and initializes it chunk by chunk
+     *
+     * @param size Domain size (= number of cells) without ghost cells
+     * @param chunkSize Number of cells per chunk, the memory used is about 6 * chunkSize values
+     */
+    OutOfCoreSimulation(const Scenarios::Scenario& scenario, IndexType size, const std::string& fileName, IndexType chunkSize = IndexType(1) << 20);
+    ~OutOfCoreSimulation();
+
+    OutOfCoreSimulation(const OutOfCoreSimulation&)            = delete;
+    OutOfCoreSimulation& operator=(const OutOfCoreSimulation&) = delete;
+
+    /**
+     * Adds a writer that is called every interval-th step, the writer reads
+     * the mapped file
+     */
+    void addWriter(Writers::Writer& writer, unsigned int interval = 1);
+
+    /**
+     * Enables the diagnostics and writes them after every step
+     *
+     * @param writer The writer or nullptr to disable the diagnostics
+     */
+    void setDiagnosticsWriter(Writers::DiagnosticsWriter* writer);
+
+    /**
+     * Enables the periodic scan for NaN/Inf and negative water heights
+     *
+     * Disabled by default: a failed check reports the bad cell and exits the
+     * process through Tools::Logger::error, so only standalone runs should
+     * enable it. Embedding code can scan the state itself with
+     * Tools::HealthCheck::scan() instead.
+     *
+     * @param interval Number of time steps between two health checks (0 = disabled)
+     */
+    void setCheckInterval(unsigned int interval);
+
+    /**
+     * @param left Boundary condition (not owned), nullptr for outflow
+     * @param right Boundary condition (not owned), nullptr for outflow
+     */
+    void setBoundaryConditions(Blocks::BoundaryCondition* left, Blocks::BoundaryCondition* right);
+
+    /**
+     * Sets a uniform bottom friction (spatially varying coefficients are
+     * not supported out of core)
+     */
+    void setFriction(Blocks::WavePropagationBlock::FrictionLaw law, RealType coefficient);
+
+    /**
+     * Writes the current state with all writers, e.g. the initial data
+     */
+    void writeOutput();
+
+    /**
+     * Does one time step
+     *
+     * @param maxTimeStep Upper bound for the time step (in addition to the CFL condition)
+     * @return The time step size
+     */
+    RealType step(RealType maxTimeStep = std::numeric_limits<RealType>::max());
+
+    double       getTime() const;
+    unsigned int getStep() const;
+    IndexType    getSize() const;
+    IndexType    getChunkSize() const;
+    RealType     getCellSize() const;
+
+    /**
+     * @return Water height of the inner cells (mapped, no copy)
+     */
+    std::span<const RealType> getHeight() const;
+
+    /**
+     * @return Momentum of the inner cells (mapped, no copy)
+     */
+    std::span<const RealType> getMomentum() const;
+  };
+
+} // namespace Runners
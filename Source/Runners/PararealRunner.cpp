@@ -0,0 +1,274 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#include "PararealRunner.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+namespace {
+
+  /**
+   * Initial values of a scenario averaged over groups of cells
+   */
+  class CoarseScenario: public Scenarios::Scenario {
+  private:
+    const Scenarios::Scenario& scenario_;
+    IndexType                  size_;
+    unsigned int               coarsening_;
+
+  public:
+    CoarseScenario(const Scenarios::Scenario& scenario, IndexType size, unsigned int coarsening):
+      scenario_(scenario),
+      size_(size),
+      coarsening_(coarsening) {}
+
+    RealType getCellSize() const override { return scenario_.getCellSize() * RealType(coarsening_); }
+
+    RealType getHeight(IndexType pos) const override {
+      if (pos == 0) {
+        return scenario_.getHeight(0);
+      }
+
+      const IndexType begin = (pos - 1) * coarsening_ + 1;
+      if (begin > size_) {
+        return scenario_.getHeight(size_ + 1);
+      }
+
+      const IndexType end = std::min(begin + coarsening_, size_ + 1);
+      RealType        sum = RealType(0.0);
+      for (IndexType i = begin; i < end; i++) {
+        sum += scenario_.getHeight(i);
+      }
+
+      return sum / RealType(end - begin);
+    }
+  };
+
+  /** State vectors hold the inner h followed by the inner hu */
+  void loadState(const std::vector<RealType>& state, Runners::Simulation& simulation) {
+    const IndexType size = simulation.getSize();
+    std::copy(state.begin(), state.begin() + size, simulation.getHeight().begin());
+    std::copy(state.begin() + size, state.end(), simulation.getMomentum().begin());
+  }
+
+  void storeState(const Runners::Simulation& simulation, std::vector<RealType>& state) {
+    const std::span<const RealType> h  = simulation.getHeight();
+    const std::span<const RealType> hu = simulation.getMomentum();
+    state.resize(h.size() + hu.size());
+    std::copy(h.begin(), h.end(), state.begin());
+    std::copy(hu.begin(), hu.end(), state.begin() + h.size());
+  }
+
+  double getMaxDifference(const std::vector<RealType>& a, const std::vector<RealType>& b) {
+    double maxDifference = 0;
+    for (std::size_t i = 0; i < a.size(); i++) {
+      maxDifference = std::max(maxDifference, std::abs(double(a[i]) - double(b[i])));
+    }
+
+    return maxDifference;
+  }
+
+} // namespace
+
+Runners::PararealRunner::PararealRunner(
+  const Scenarios::Scenario& scenario, IndexType size, unsigned int numSlices, unsigned int coarsening, unsigned int numThreads
+):
+  size_(size),
+  coarsening_(std::max(coarsening, 1u)),
+  numSlices_(std::max(numSlices, 1u)),
+  numThreads_(std::min(numThreads > 0 ? numThreads : std::max(std::thread::hardware_concurrency(), 1u), numSlices_)),
+  coarse_(nullptr),
+  states_(numSlices_ + 1),
+  fineResults_(numSlices_),
+  coarseResults_(numSlices_) {
+
+  for (unsigned int i = 0; i < numThreads_; i++) {
+    fine_.push_back(new Simulation(scenario, size_));
+    // The propagators run concurrently, the logger is not thread-safe
+    fine_.back()->setCheckInterval(0);
+  }
+
+  const CoarseScenario coarseScenario(scenario, size_, coarsening_);
+  coarse_ = new Simulation(coarseScenario, (size_ + coarsening_ - 1) / coarsening_);
+  coarse_->setCheckInterval(0);
+
+  storeState(*fine_[0], states_[0]);
+}
+
+Runners::PararealRunner::~PararealRunner() {
+  for (Simulation* simulation : fine_) {
+    delete simulation;
+  }
+  delete coarse_;
+}
+
+void Runners::PararealRunner::setBoundaryConditions(Blocks::BoundaryCondition* left, Blocks::BoundaryCondition* right) {
+  for (Simulation* simulation : fine_) {
+    simulation->setBoundaryConditions(left, right);
+  }
+  coarse_->setBoundaryConditions(left, right);
+}
+
+double Runners::PararealRunner::getSliceBegin(unsigned int slice, double endTime) const {
+  return slice == numSlices_ ? endTime : endTime * slice / numSlices_;
+}
+
+void Runners::PararealRunner::propagateFine(Simulation& simulation, unsigned int slice, double endTime) {
+  loadState(states_[slice], simulation);
+  simulation.setTime(getSliceBegin(slice, endTime));
+  simulation.advanceTo(getSliceBegin(slice + 1, endTime));
+  storeState(simulation, fineResults_[slice]);
+}
+
+void Runners::PararealRunner::propagateCoarse(const std::vector<RealType>& state, unsigned int slice, double endTime, std::vector<RealType>& result) {
+  const std::span<RealType> h  = coarse_->getHeight();
+  const std::span<RealType> hu = coarse_->getMomentum();
+
+  // Restriction: average of the fine cells, the last coarse cell may cover fewer cells
+  for (IndexType j = 0; j < h.size(); j++) {
+    const IndexType begin = j * coarsening_;
+    const IndexType end   = std::min(begin + coarsening_, size_);
+
+    RealType hSum  = RealType(0.0);
+    RealType huSum = RealType(0.0);
+    for (IndexType i = begin; i < end; i++) {
+      hSum += state[i];
+      huSum += state[size_ + i];
+    }
+    h[j]  = hSum / RealType(end - begin);
+    hu[j] = huSum / RealType(end - begin);
+  }
+
+  coarse_->setTime(getSliceBegin(slice, endTime));
+  coarse_->advanceTo(getSliceBegin(slice + 1, endTime));
+
+  // Prolongation: piecewise constant
+  result.resize(2 * size_);
+  for (IndexType i = 0; i < size_; i++) {
+    result[i]         = h[i / coarsening_];
+    result[size_ + i] = hu[i / coarsening_];
+  }
+}
+
+double Runners::PararealRunner::runSerial(double endTime) {
+  const auto start = std::chrono::steady_clock::now();
+
+  Simulation& simulation = *fine_[0];
+  loadState(states_[0], simulation);
+  simulation.setTime(0);
+  for (unsigned int n = 0; n < numSlices_; n++) {
+    simulation.advanceTo(getSliceBegin(n + 1, endTime));
+  }
+  storeState(simulation, reference_);
+
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+unsigned int Runners::PararealRunner::run(double endTime, unsigned int maxIterations, double tolerance) {
+  const auto start = std::chrono::steady_clock::now();
+  iterations_.clear();
+
+  // Initial prediction with the coarse propagator only
+  for (unsigned int n = 0; n < numSlices_; n++) {
+    propagateCoarse(states_[n], n, endTime, coarseResults_[n]);
+    states_[n + 1] = coarseResults_[n];
+  }
+
+  std::vector<RealType> coarseResult;
+
+  unsigned int k = 0;
+  while (k < maxIterations) {
+    // Fine propagation of all slices that are not exact yet, concurrently
+    std::atomic<unsigned int> nextSlice(k);
+    const auto                work = [this, &nextSlice, endTime](unsigned int worker) {
+      for (unsigned int slice = nextSlice++; slice < numSlices_; slice = nextSlice++) {
+        propagateFine(*fine_[worker], slice, endTime);
+      }
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned int t = 1; t < numThreads_; t++) {
+      threads.emplace_back(work, t);
+    }
+    work(0);
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+
+    // Sequential correction, the start of slice k is exact so its end is the fine solution
+    double maxUpdate = getMaxDifference(fineResults_[k], states_[k + 1]);
+    states_[k + 1]   = fineResults_[k];
+
+    for (unsigned int n = k + 1; n < numSlices_; n++) {
+      propagateCoarse(states_[n], n, endTime, coarseResult);
+
+      std::vector<RealType>&       state     = states_[n + 1];
+      const std::vector<RealType>& fine      = fineResults_[n];
+      const std::vector<RealType>& oldCoarse = coarseResults_[n];
+      for (std::size_t i = 0; i < state.size(); i++) {
+        const RealType value = coarseResult[i] + fine[i] - oldCoarse[i];
+        maxUpdate            = std::max(maxUpdate, std::abs(double(value) - double(state[i])));
+        state[i]             = value;
+      }
+
+      coarseResults_[n].swap(coarseResult);
+    }
+
+    k++;
+
+    const double maxError = reference_.empty() ? -1.0 : getMaxDifference(states_.back(), reference_);
+    iterations_.push_back({maxUpdate, maxError, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()});
+
+    if (maxUpdate <= tolerance || k == numSlices_) {
+      break;
+    }
+  }
+
+  return k;
+}
+
+const std::vector<Runners::PararealRunner::Iteration>& Runners::PararealRunner::getIterations() const { return iterations_; }
+
+unsigned int Runners::PararealRunner::getNumSlices() const { return numSlices_; }
+
+unsigned int Runners::PararealRunner::getNumThreads() const { return numThreads_; }
+
+std::span<const RealType> Runners::PararealRunner::getHeight() const { return {states_.back().data(), size_}; }
+
+std::span<const RealType> Runners::PararealRunner::getMomentum() const { return {states_.back().data() + size_, size_}; }
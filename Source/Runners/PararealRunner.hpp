@@ -0,0 +1,169 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "Blocks/BoundaryConditions.hpp"
+#include "Runners/Simulation.hpp"
+#include "Scenarios/Scenario.hpp"
+#include "SWE1DExport.hpp"
+#include "Tools/IndexType.hpp"
+#include "Tools/RealType.hpp"
+
+namespace Runners {
+
+  /**
+   * Parallel-in-time integration with the Parareal algorithm
+   *
+   * The time interval is split into slices. A cheap coarse propagator G
+   * (the same solver on a grid coarsened by a constant factor) predicts the
+   * state at the start of every slice sequentially, then each iteration
+   * runs the fine propagator F (the production grid) on all slices
+   * concurrently and corrects the predictions sequentially:
+   * <pre>
+   *   U[n+1] = G(U_new[n]) + F(U_old[n]) - G(U_old[n])
+   * </pre>
+   * After k iterations the first k slices are exact, so the result equals
+   * the serial solution (F applied slice by slice) after at most as many
+   * iterations as slices. The speedup comes from stopping earlier, when the
+   * change of the slice states drops below a tolerance.
+   *
+   * The propagators are Simulation objects without health checks. The
+   * boundary conditions are shared by all propagators and must not keep
+   * state between calls (i.e. no inflow boundary).
+   */
+  class SWE1D_EXPORT PararealRunner {
+  public:
+    struct Iteration {
+      /** Maximum change of h and hu at the slice ends compared to the previous iteration */
+      double maxUpdate;
+      /** Maximum difference of h and hu to the serial solution at the end time (negative if unknown) */
+      double maxError;
+      /** Wall time since the start of run() */
+      double seconds;
+    };
+
+  private:
+    IndexType    size_;
+    unsigned int coarsening_;
+    unsigned int numSlices_;
+    unsigned int numThreads_;
+
+    /** Fine propagator of each thread */
+    std::vector<Simulation*> fine_;
+    Simulation*              coarse_;
+
+    /** Inner h followed by inner hu at the start of each slice and at the end time */
+    std::vector<std::vector<RealType>> states_;
+    /** Fine solution at the end of each slice, computed from the previous iteration */
+    std::vector<std::vector<RealType>> fineResults_;
+    /** Coarse prediction at the end of each slice from the current states */
+    std::vector<std::vector<RealType>> coarseResults_;
+
+    /** Serial solution at the end time (empty if unknown) */
+    std::vector<RealType> reference_;
+
+    std::vector<Iteration> iterations_;
+
+    /**
+     * Runs a fine propagator over a slice, starting from the state of the slice
+     */
+    void propagateFine(Simulation& simulation, unsigned int slice, double endTime);
+
+    /**
+     * Runs the coarse propagator over a slice, the state and the result are on the fine grid
+     */
+    void propagateCoarse(const std::vector<RealType>& state, unsigned int slice, double endTime, std::vector<RealType>& result);
+
+    double getSliceBegin(unsigned int slice, double endTime) const;
+
+  public:
+    /**
+     * @param size Domain size (= number of cells) of the fine propagator
+     * @param numSlices Number of time slices
+     * @param coarsening Number of fine cells per cell of the coarse propagator
+     * @param numThreads Number of threads for the fine propagators, 0 = all cores
+     */
+    PararealRunner(const Scenarios::Scenario& scenario, IndexType size, unsigned int numSlices, unsigned int coarsening = 4, unsigned int numThreads = 0);
+    ~PararealRunner();
+
+    PararealRunner(const PararealRunner&)            = delete;
+    PararealRunner& operator=(const PararealRunner&) = delete;
+
+    /**
+     * @param left Boundary condition (not owned, stateless), nullptr for outflow
+     * @param right Boundary condition (not owned, stateless), nullptr for outflow
+     */
+    void setBoundaryConditions(Blocks::BoundaryCondition* left, Blocks::BoundaryCondition* right);
+
+    /**
+     * Computes the serial solution (fine propagator, slice by slice, one
+     * thread) as reference for the convergence check
+     *
+     * @return The wall time in seconds
+     */
+    double runSerial(double endTime);
+
+    /**
+     * Iterates until the maximum change of the slice states is at most
+     * the tolerance or maxIterations is reached
+     *
+     * @return The number of iterations
+     */
+    unsigned int run(double endTime, unsigned int maxIterations, double tolerance);
+
+    /**
+     * @return Convergence and timing of each iteration of the last run()
+     */
+    const std::vector<Iteration>& getIterations() const;
+
+    unsigned int getNumSlices() const;
+    unsigned int getNumThreads() const;
+
+    /**
+     * @return Water height of the inner cells at the end time
+     */
+    std::span<const RealType> getHeight() const;
+
+    /**
+     * @return Momentum of the inner cells at the end time
+     */
+    std::span<const RealType> getMomentum() const;
+  };
+
+} // namespace Runners
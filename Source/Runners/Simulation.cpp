@@ -0,0 +1,212 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#include "Simulation.hpp"
+
+#include <algorithm>
+
+#include "Tools/Grid.hpp"
+
+Runners::Simulation::Simulation(const Scenarios::Scenario& scenario, IndexType size):
+  size_(size),
+  h_(new RealType[size + 2]),
+  hu_(new RealType[size + 2]),
+  block_(h_, hu_, size, scenario.getCellSize()),
+  time_(0),
+  step_(0),
+  diagnosticsWriter_(nullptr),
+  envelopeWriter_(nullptr),
+  envelopeInterval_(0),
+  healthCheck_(0) {
+
+  if (!scenario.isUniform()) {
+    std::vector<RealType> cellSizes(size);
+    for (IndexType i = 0; i < size; i++) {
+      cellSizes[i] = scenario.getCellWidth(i + 1);
+    }
+    block_.setCellSizes(cellSizes.data());
+  }
+
+  reset(scenario);
+}
+
+Runners::Simulation::~Simulation() {
+  // Free allocated memory
+  delete[] h_;
+  delete[] hu_;
+}
+
+void Runners::Simulation::reset(const Scenarios::Scenario& scenario) {
+  // Initialize water height and momentum
+  for (IndexType i = 0; i < size_ + 2; i++) {
+    h_[i]  = scenario.getHeight(i);
+    hu_[i] = scenario.getMomentum(i);
+  }
+
+  time_ = 0;
+  step_ = 0;
+
+  // Starts a new envelope
+  if (block_.isEnvelopeEnabled()) {
+    block_.setEnvelopeEnabled(true);
+  }
+}
+
+void Runners::Simulation::setTime(double time) { time_ = time; }
+
+void Runners::Simulation::addWriter(Writers::Writer& writer, unsigned int interval) { writers_.push_back({&writer, std::max(interval, 1u)}); }
+
+void Runners::Simulation::setDiagnosticsWriter(Writers::DiagnosticsWriter* writer) {
+  diagnosticsWriter_ = writer;
+  block_.setDiagnosticsEnabled(writer != nullptr);
+}
+
+void Runners::Simulation::setEnvelopeWriter(Writers::EnvelopeWriter* writer, unsigned int interval) {
+  envelopeWriter_   = writer;
+  envelopeInterval_ = interval;
+  block_.setEnvelopeEnabled(writer != nullptr);
+}
+
+void Runners::Simulation::writeEnvelope() {
+  if (envelopeWriter_) {
+    envelopeWriter_->write(time_, block_.getEnvelope(), size_);
+  }
+}
+
+void Runners::Simulation::setCheckInterval(unsigned int interval) { healthCheck_ = Tools::HealthCheck(interval); }
+
+void Runners::Simulation::setBoundaryConditions(Blocks::BoundaryCondition* left, Blocks::BoundaryCondition* right) { block_.setBoundaryConditions(left, right); }
+
+void Runners::Simulation::writeOutput() {
+  for (const WriterEntry& entry : writers_) {
+    entry.writer->write(time_, h_, hu_, size_);
+  }
+}
+
+RealType Runners::Simulation::step(RealType maxTimeStep) {
+  // Update boundaries
+  block_.applyBoundaryConditions(time_);
+
+  // Compute numerical flux on each edge
+  const RealType dt = std::min(block_.computeNumericalFluxes(), maxTimeStep);
+
+  // Update unknowns from net updates
+  block_.updateUnknowns(dt, time_ + dt);
+
+  completeStep(dt, block_.getDiagnostics());
+
+  writeOutput(step_);
+
+  return dt;
+}
+
+void Runners::Simulation::completeStep(RealType dt, const Blocks::Diagnostics& diagnostics) {
+  time_ += dt;
+  step_++;
+
+  // Abort with diagnostics if the solution became unphysical
+  healthCheck_.check(step_, time_, h_, hu_, size_);
+
+  if (diagnosticsWriter_) {
+    diagnosticsWriter_->write(step_, time_, diagnostics);
+  }
+
+  if (isEnvelopeStep(step_)) {
+    writeEnvelope();
+  }
+}
+
+bool Runners::Simulation::isOutputStep(unsigned int step) const {
+  return std::any_of(writers_.begin(), writers_.end(), [step](const WriterEntry& entry) { return step % entry.interval == 0; });
+}
+
+bool Runners::Simulation::isSynchronousStep(unsigned int step) const {
+  return healthCheck_.isDue(step) || diagnosticsWriter_ != nullptr || isEnvelopeStep(step) || isOutputStep(step);
+}
+
+bool Runners::Simulation::isEnvelopeStep(unsigned int step) const { return envelopeWriter_ != nullptr && envelopeInterval_ > 0 && step % envelopeInterval_ == 0; }
+
+void Runners::Simulation::writeOutput(unsigned int step) { writeOutput(step, time_, h_, hu_); }
+
+void Runners::Simulation::writeOutput(unsigned int step, double time, const RealType* h, const RealType* hu) {
+  for (const WriterEntry& entry : writers_) {
+    if (step % entry.interval == 0) {
+      entry.writer->write(time, h, hu, size_);
+    }
+  }
+}
+
+unsigned int Runners::Simulation::advanceTo(double endTime) {
+  unsigned int numSteps = 0;
+
+  while (time_ < endTime) {
+    const double remaining = endTime - time_;
+    step(static_cast<RealType>(remaining));
+    numSteps++;
+
+    // Avoid a tiny last step due to rounding
+    if (endTime - time_ <= remaining * 1e-12) {
+      time_ = endTime;
+    }
+  }
+
+  return numSteps;
+}
+
+double Runners::Simulation::getTime() const { return time_; }
+
+unsigned int Runners::Simulation::getStep() const { return step_; }
+
+IndexType Runners::Simulation::getSize() const { return size_; }
+
+RealType Runners::Simulation::getCellSize() const { return block_.getCellSize(); }
+
+RealType Runners::Simulation::getFrontPosition(const Blocks::Diagnostics& diagnostics) const {
+  if (block_.isUniform()) {
+    return diagnostics.getFrontPosition(block_.getCellSize());
+  }
+
+  return diagnostics.getFrontPosition(Tools::Grid::getCellCenters(block_.getCellSizes().data() + 1, size_));
+}
+
+std::span<RealType> Runners::Simulation::getHeight() { return {h_ + 1, size_}; }
+
+std::span<const RealType> Runners::Simulation::getHeight() const { return {h_ + 1, size_}; }
+
+std::span<RealType> Runners::Simulation::getMomentum() { return {hu_ + 1, size_}; }
+
+std::span<const RealType> Runners::Simulation::getMomentum() const { return {hu_ + 1, size_}; }
+
+Blocks::WavePropagationBlock& Runners::Simulation::getBlock() { return block_; }
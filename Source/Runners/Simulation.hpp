@@ -0,0 +1,241 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#pragma once
+
+#include <limits>
+#include <span>
+#include <vector>
+
+#include "Blocks/WavePropagationBlock.hpp"
+#include "Scenarios/Scenario.hpp"
+#include "SWE1DExport.hpp"
+#include "Tools/HealthCheck.hpp"
+#include "Tools/IndexType.hpp"
+#include "Tools/RealType.hpp"
+#include "Writers/DiagnosticsWriter.hpp"
+#include "Writers/EnvelopeWriter.hpp"
+#include "Writers/Writer.hpp"
+
+namespace Runners {
+
+  /**
+   * An embeddable simulation of one channel
+   *
+   * Owns the unknowns and the wave propagation block. Writers are not owned
+   * and must outlive the simulation. The state can be accessed (and
+   * modified) in place through getHeight() and getMomentum().
+   */
+  class SWE1D_EXPORT Simulation {
+  private:
+    struct WriterEntry {
+      Writers::Writer* writer;
+      /** Write every interval-th step */
+      unsigned int interval;
+    };
+
+    IndexType size_;
+
+    /** Water height (including ghost cells) */
+    RealType* h_;
+    /** Momentum (including ghost cells) */
+    RealType* hu_;
+
+    Blocks::WavePropagationBlock block_;
+
+    /** Current time of simulation */
+    double time_;
+    /** Number of time steps done */
+    unsigned int step_;
+
+    std::vector<WriterEntry> writers_;
+
+    Writers::DiagnosticsWriter* diagnosticsWriter_;
+
+    Writers::EnvelopeWriter* envelopeWriter_;
+    /** Write the envelope every envelopeInterval_-th step (0 = only in writeEnvelope()) */
+    unsigned int envelopeInterval_;
+
+    Tools::HealthCheck healthCheck_;
+
+    bool isEnvelopeStep(unsigned int step) const;
+
+  public:
+    /**
+     * @param size Domain size (= number of cells) without ghost cells
+     *
+     * The block uses the cell widths of the scenario if its grid is not uniform.
+     */
+    Simulation(const Scenarios::Scenario& scenario, IndexType size);
+    ~Simulation();
+
+    Simulation(const Simulation&)            = delete;
+    Simulation& operator=(const Simulation&) = delete;
+
+    /**
+     * Resets the unknowns to the initial values of a scenario and the time to 0
+     */
+    void reset(const Scenarios::Scenario& scenario);
+
+    /**
+     * Sets the current time, e.g. after the state was replaced through
+     * getHeight() and getMomentum()
+     */
+    void setTime(double time);
+
+    /**
+     * Adds a writer that is called every interval-th step
+     */
+    void addWriter(Writers::Writer& writer, unsigned int interval = 1);
+
+    /**
+     * Enables the diagnostics and writes them after every step
+     *
+     * @param writer The writer or nullptr to disable the diagnostics
+     */
+    void setDiagnosticsWriter(Writers::DiagnosticsWriter* writer);
+
+    /**
+     * Enables the envelope (maximum depth, maximum speed and arrival time of
+     * each cell), which is accumulated during the update of the unknowns
+     *
+     * @param writer The writer or nullptr to disable the envelope
+     * @param interval Number of time steps between two checkpoints (0 = only
+     *  written by writeEnvelope(), e.g. at the end of the simulation)
+     */
+    void setEnvelopeWriter(Writers::EnvelopeWriter* writer, unsigned int interval = 0);
+
+    /**
+     * Writes the current envelope (if enabled)
+     */
+    void writeEnvelope();
+
+    /**
+     * Enables the periodic scan for NaN/Inf and negative water heights
+     *
+     * Disabled by default: a failed check reports the bad cell and exits the
+     * process through Tools::Logger::error, so only standalone runs should
+     * enable it. Embedding code can scan the state itself with
+     * Tools::HealthCheck::scan() instead.
+     *
+     * @param interval Number of time steps between two health checks (0 = disabled)
+     */
+    void setCheckInterval(unsigned int interval);
+
+    /**
+     * @param left Boundary condition (not owned), nullptr for outflow
+     * @param right Boundary condition (not owned), nullptr for outflow
+     */
+    void setBoundaryConditions(Blocks::BoundaryCondition* left, Blocks::BoundaryCondition* right);
+
+    /**
+     * Writes the current state with all writers, e.g. the initial data
+     */
+    void writeOutput();
+
+    /**
+     * Does one time step
+     *
+     * @param maxTimeStep Upper bound for the time step (in addition to the CFL condition)
+     * @return The time step size
+     */
+    RealType step(RealType maxTimeStep = std::numeric_limits<RealType>::max());
+
+    /**
+     * Finishes a time step that was computed on the block by an external
+     * executor: advances the time, runs the health check and writes the
+     * diagnostics and envelope checkpoints (but does not call the writers)
+     */
+    void completeStep(RealType dt, const Blocks::Diagnostics& diagnostics);
+
+    /**
+     * @return True if any writer has to be called after the given step
+     */
+    bool isOutputStep(unsigned int step) const;
+
+    /**
+     * @return True if completeStep() or the writers read the whole state
+     *  after the given step (health check, diagnostics, envelope or output), i.e. a
+     *  parallel executor must synchronize all threads
+     */
+    bool isSynchronousStep(unsigned int step) const;
+
+    /**
+     * Calls the writers due in the given step with the current state
+     */
+    void writeOutput(unsigned int step);
+
+    /**
+     * Calls the writers due in the given step, e.g. with a copy of the state
+     *
+     * @param h Water height (including ghost cells)
+     * @param hu Momentum (including ghost cells)
+     */
+    void writeOutput(unsigned int step, double time, const RealType* h, const RealType* hu);
+
+    /**
+     * Does time steps until endTime is reached, the last step is shortened
+     * to hit endTime exactly
+     *
+     * @return The number of time steps
+     */
+    unsigned int advanceTo(double endTime);
+
+    double       getTime() const;
+    unsigned int getStep() const;
+    IndexType    getSize() const;
+    RealType     getCellSize() const;
+
+    /**
+     * @return Position of the front of the diagnostics on the grid of the block
+     */
+    RealType getFrontPosition(const Blocks::Diagnostics& diagnostics) const;
+
+    /**
+     * @return Water height of the inner cells (no copy)
+     */
+    std::span<RealType>       getHeight();
+    std::span<const RealType> getHeight() const;
+
+    /**
+     * @return Momentum of the inner cells (no copy)
+     */
+    std::span<RealType>       getMomentum();
+    std::span<const RealType> getMomentum() const;
+
+    Blocks::WavePropagationBlock& getBlock();
+  };
+
+} // namespace Runners
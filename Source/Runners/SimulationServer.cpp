@@ -0,0 +1,590 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#include "SimulationServer.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <new>
+#include <span>
+#include <sstream>
+#include <utility>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "Blocks/BoundaryConditions.hpp"
+#include "Runners/Simulation.hpp"
+#include "Scenarios/DamBreakScenario.hpp"
+#include "Tools/HealthCheck.hpp"
+#include "Tools/Logger.hpp"
+#include "Writers/Writer.hpp"
+
+namespace {
+
+  double now() { return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count(); }
+
+  /**
+   * Appends the shortest representation that reads back to the same value
+   */
+  template <class T>
+  void appendNumber(std::string& buffer, T value) {
+    char                       digits[32];
+    const std::to_chars_result result = std::to_chars(digits, digits + sizeof(digits), value);
+    buffer.append(digits, result.ptr);
+  }
+
+  template <class T>
+  bool parseNumber(const std::string& text, T& value) {
+    const std::from_chars_result result = std::from_chars(text.data(), text.data() + text.size(), value);
+    return result.ec == std::errc() && result.ptr == text.data() + text.size();
+  }
+
+  /**
+   * Sends the whole buffer, a vanished client is ignored
+   */
+  void sendAll(int connection, const std::string& data) {
+    std::size_t sent = 0;
+    while (sent < data.size()) {
+      const ssize_t n = send(connection, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+      if (n < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        return;
+      }
+      sent += static_cast<std::size_t>(n);
+    }
+  }
+
+  /**
+   * Streams the field of every interval-th step to the client of the current request
+   */
+  class FrameWriter: public Writers::Writer {
+  public:
+    std::string* buffer     = nullptr;
+    int          connection = -1;
+    /** 0 = no intermediate frames */
+    unsigned int interval = 0;
+    unsigned int count    = 0;
+
+    void write(const RealType time, const RealType* h, const RealType* hu, IndexType size) override {
+      if (interval == 0 || ++count % interval != 0) {
+        return;
+      }
+
+      writeFrame(time, h, hu, size);
+    }
+
+    void writeFrame(double time, const RealType* h, const RealType* hu, IndexType size) {
+      buffer->append("FRAME time=");
+      appendNumber(*buffer, time);
+      buffer->append(" size=");
+      appendNumber(*buffer, size);
+      buffer->push_back('\n');
+      for (IndexType i = 1; i < size + 1; i++) {
+        appendNumber(*buffer, h[i]);
+        buffer->push_back(' ');
+        appendNumber(*buffer, hu[i]);
+        buffer->push_back('\n');
+      }
+
+      // Sent right away, the buffer keeps its capacity
+      sendAll(connection, *buffer);
+      buffer->clear();
+    }
+  };
+
+} // namespace
+
+/**
+ * State of one worker thread that is kept between requests
+ */
+class Runners::SimulationServer::Worker {
+public:
+  Simulation* simulation = nullptr;
+  IndexType   size       = 0;
+
+  /** Connection served by this worker (-1 = none), guarded by the server mutex */
+  int connection = -1;
+
+  /** Received bytes that do not form a complete line yet */
+  std::string input;
+  /** Response of the current request */
+  std::string response;
+
+  FrameWriter frameWriter;
+
+  ~Worker() { delete simulation; }
+
+  /**
+   * Resets the simulation to the scenario, reallocates only if the size changed
+   */
+  Simulation& prepare(const Scenarios::Scenario& scenario, IndexType newSize) {
+    if (simulation != nullptr && size == newSize) {
+      simulation->reset(scenario);
+      return *simulation;
+    }
+
+    delete simulation;
+    simulation = nullptr;
+    simulation = new Simulation(scenario, newSize);
+    size       = newSize;
+
+    // Unphysical states are reported to the client instead of aborting the server
+    simulation->setCheckInterval(0);
+    simulation->getBlock().setDiagnosticsEnabled(true);
+    simulation->addWriter(frameWriter);
+
+    return *simulation;
+  }
+};
+
+Runners::SimulationServer::SimulationServer(const std::string& socketPath, unsigned int numWorkers, IndexType warmSize):
+  socketPath_(socketPath),
+  socket_(-1),
+  stopping_(false),
+  numRequests_(0) {
+
+  sockaddr_un address = {};
+  address.sun_family  = AF_UNIX;
+  if (socketPath_.size() >= sizeof(address.sun_path)) {
+    Tools::Logger::logger.error(("Socket path too long: " + socketPath_).c_str());
+  }
+  std::copy(socketPath_.begin(), socketPath_.end(), address.sun_path);
+
+  socket_ = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (socket_ < 0) {
+    Tools::Logger::logger.error("Could not create the server socket");
+  }
+
+  unlink(socketPath_.c_str());
+  if (bind(socket_, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 || listen(socket_, 64) != 0) {
+    close(socket_);
+    Tools::Logger::logger.error(("Could not listen on " + socketPath_).c_str());
+  }
+
+  if (numWorkers == 0) {
+    numWorkers = std::max(std::thread::hardware_concurrency(), 1u);
+  }
+
+  // Warm buffers, the first request of this size does not allocate
+  Scenarios::DamBreakScenario scenario(std::max<IndexType>(warmSize, 1));
+  for (unsigned int i = 0; i < numWorkers; i++) {
+    workers_.push_back(new Worker());
+    if (warmSize > 0) {
+      workers_.back()->prepare(scenario, warmSize);
+    }
+  }
+
+  for (Worker* worker : workers_) {
+    threads_.emplace_back(&SimulationServer::serve, this, std::ref(*worker));
+  }
+}
+
+Runners::SimulationServer::~SimulationServer() {
+  stop();
+  for (std::thread& thread : threads_) {
+    thread.join();
+  }
+
+  for (const int connection : connections_) {
+    close(connection);
+  }
+  close(socket_);
+  unlink(socketPath_.c_str());
+
+  for (Worker* worker : workers_) {
+    delete worker;
+  }
+}
+
+void Runners::SimulationServer::run() {
+  Tools::Logger::logger.info(("Listening on " + socketPath_ + " with " + std::to_string(workers_.size()) + " workers").c_str());
+
+  while (!stopping_) {
+    const int connection = accept(socket_, nullptr, nullptr);
+    if (connection < 0) {
+      // Also returns after stop() shut the socket down
+      continue;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      connections_.push_back(connection);
+    }
+    condition_.notify_one();
+  }
+
+  const Latencies dispatch = getDispatchLatencies();
+  const Latencies total    = getTotalLatencies();
+  Tools::Logger::logger
+    << "Served " << total.count << " requests, dispatch p50/p99 " << dispatch.p50 * 1e6 << "/" << dispatch.p99 * 1e6 << " us, total p50/p99 " << total.p50 * 1e6
+    << "/" << total.p99 * 1e6 << " us" << std::endl;
+}
+
+void Runners::SimulationServer::stop() {
+  stopping_ = true;
+
+  {
+    // Idle connections return from recv(), running requests still send their response
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (Worker* worker : workers_) {
+      if (worker->connection >= 0) {
+        shutdown(worker->connection, SHUT_RD);
+      }
+    }
+  }
+  condition_.notify_all();
+
+  shutdown(socket_, SHUT_RDWR);
+}
+
+void Runners::SimulationServer::serve(Worker& worker) {
+  worker.frameWriter.buffer = &worker.response;
+
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      condition_.wait(lock, [this] { return stopping_ || !connections_.empty(); });
+      if (stopping_) {
+        return;
+      }
+      worker.connection = connections_.front();
+      connections_.pop_front();
+    }
+
+    worker.input.clear();
+    bool open = true;
+    while (open) {
+      const std::size_t newline = worker.input.find('\n');
+      if (newline == std::string::npos) {
+        char          buffer[4096];
+        const ssize_t n = recv(worker.connection, buffer, sizeof(buffer), 0);
+        if (n < 0 && errno == EINTR) {
+          continue;
+        }
+        if (n <= 0) {
+          break;
+        }
+        worker.input.append(buffer, static_cast<std::size_t>(n));
+        continue;
+      }
+
+      const double      received = now();
+      const std::string request  = worker.input.substr(0, newline);
+      worker.input.erase(0, newline + 1);
+
+      if (!handle(worker, worker.connection, request, received)) {
+        open = false;
+        stop();
+      }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    close(worker.connection);
+    worker.connection = -1;
+  }
+}
+
+bool Runners::SimulationServer::handle(Worker& worker, int connection, const std::string& request, double received) {
+  std::istringstream tokens(request);
+  std::string        command;
+  tokens >> command;
+
+  std::string& response = worker.response;
+  response.clear();
+
+  if (command.empty()) {
+    return true;
+  }
+
+  if (command == "STATS") {
+    const auto appendLatencies = [&response](const char* name, const Latencies& latencies) {
+      const double values[]      = {latencies.p50, latencies.p90, latencies.p99, latencies.max};
+      const char*  percentiles[] = {"p50", "p90", "p99", "max"};
+      for (unsigned int i = 0; i < 4; i++) {
+        response.append(" ").append(name).append("_").append(percentiles[i]).append("=");
+        appendNumber(response, values[i] * 1e6);
+      }
+    };
+
+    const Latencies total = getTotalLatencies();
+    response.append("STATS requests=");
+    appendNumber(response, total.count);
+    appendLatencies("dispatch", getDispatchLatencies());
+    appendLatencies("total", total);
+    response.append("\nEND\n");
+    sendAll(connection, response);
+    return true;
+  }
+
+  if (command == "SHUTDOWN") {
+    sendAll(connection, "OK\nEND\n");
+    return false;
+  }
+
+  if (command != "RUN") {
+    sendAll(connection, "ERROR unknown command " + command + "\nEND\n");
+    return true;
+  }
+
+  // Parameters of the run
+  IndexType                                 size          = 0;
+  double                                    endTime       = 0;
+  unsigned int                              numSteps      = 0;
+  RealType                                  leftHeight    = RealType(15);
+  RealType                                  rightHeight   = RealType(10);
+  std::string                               boundaries[2] = {"outflow", "outflow"};
+  Blocks::WavePropagationBlock::FrictionLaw frictionLaw   = Blocks::WavePropagationBlock::NO_FRICTION;
+  RealType                                  coefficient   = RealType(0.0);
+  bool                                      field         = false;
+  bool                                      envelope      = false;
+  unsigned int                              interval      = 0;
+
+  std::string error;
+  std::string token;
+  while (error.empty() && tokens >> token) {
+    const std::size_t separator = token.find('=');
+    const std::string key       = token.substr(0, separator);
+    const std::string value     = separator == std::string::npos ? "" : token.substr(separator + 1);
+
+    bool valid = true;
+    if (key == "size") {
+      valid = parseNumber(value, size) && size > 0;
+    } else if (key == "end") {
+      valid = parseNumber(value, endTime) && endTime >= 0;
+    } else if (key == "steps") {
+      valid = parseNumber(value, numSteps);
+    } else if (key == "left") {
+      valid = parseNumber(value, leftHeight) && leftHeight >= 0;
+    } else if (key == "right") {
+      valid = parseNumber(value, rightHeight) && rightHeight >= 0;
+    } else if (key == "left-boundary" || key == "right-boundary") {
+      valid                                      = value == "outflow" || value == "reflective" || value == "periodic";
+      boundaries[key == "left-boundary" ? 0 : 1] = value;
+    } else if (key == "friction") {
+      const std::string law = value.substr(0, value.find(':'));
+      if (law == "none") {
+        frictionLaw = Blocks::WavePropagationBlock::NO_FRICTION;
+      } else if (law == "manning" || law == "chezy") {
+        frictionLaw = law == "manning" ? Blocks::WavePropagationBlock::MANNING : Blocks::WavePropagationBlock::CHEZY;
+        valid       = value.find(':') != std::string::npos && parseNumber(value.substr(value.find(':') + 1), coefficient) && coefficient > 0;
+      } else {
+        valid = false;
+      }
+    } else if (key == "output") {
+      std::istringstream outputs(value);
+      std::string        output;
+      while (std::getline(outputs, output, ',')) {
+        field    = field || output == "field";
+        envelope = envelope || output == "envelope";
+        valid    = valid && (output == "summary" || output == "field" || output == "envelope");
+      }
+    } else if (key == "interval") {
+      valid = parseNumber(value, interval);
+      field = true;
+    } else {
+      error = "unknown parameter " + key;
+    }
+
+    if (!valid) {
+      error = "invalid value of " + key;
+    }
+  }
+
+  if (error.empty() && size == 0) {
+    error = "missing size";
+  }
+  if (error.empty() && endTime == 0 && numSteps == 0) {
+    error = "missing end or steps";
+  }
+
+  if (!error.empty()) {
+    sendAll(connection, "ERROR " + error + "\nEND\n");
+    return true;
+  }
+
+  Scenarios::DamBreakScenario scenario(size, leftHeight, rightHeight);
+
+  // All per-cell arrays of the request are allocated here, a request too large for the memory must not terminate the server
+  Simulation* simulation = nullptr;
+  try {
+    simulation = &worker.prepare(scenario, size);
+    simulation->getBlock().setFriction(frictionLaw, coefficient);
+    simulation->getBlock().setEnvelopeEnabled(envelope);
+    if (envelope) {
+      // One line of three numbers (at most 24 characters each) per cell
+      response.reserve(response.size() + std::size_t(size) * 3 * 25);
+    }
+  } catch (const std::bad_alloc&) {
+    // Forces a new simulation for the next request
+    worker.size = 0;
+    sendAll(connection, "ERROR size too large\nEND\n");
+    return true;
+  }
+
+  Blocks::BoundaryCondition* leftBoundary  = Blocks::BoundaryCondition::create(boundaries[0]);
+  Blocks::BoundaryCondition* rightBoundary = Blocks::BoundaryCondition::create(boundaries[1]);
+  simulation->setBoundaryConditions(leftBoundary, rightBoundary);
+
+  worker.frameWriter.connection = connection;
+  worker.frameWriter.interval   = interval;
+  worker.frameWriter.count      = 0;
+
+  const double start = now();
+
+  if (numSteps > 0) {
+    for (unsigned int i = 0; i < numSteps; i++) {
+      simulation->step();
+    }
+  } else {
+    numSteps = simulation->advanceTo(endTime);
+  }
+
+  const double finished = now();
+
+  const std::span<const RealType> h  = std::as_const(*simulation).getHeight();
+  const std::span<const RealType> hu = std::as_const(*simulation).getMomentum();
+
+  // The last state, unless it was already streamed
+  if (field && (interval == 0 || numSteps % interval != 0)) {
+    worker.frameWriter.writeFrame(simulation->getTime(), h.data() - 1, hu.data() - 1, size);
+  }
+
+  if (envelope) {
+    const Blocks::Envelope& values = simulation->getBlock().getEnvelope();
+    response.append("ENVELOPE size=");
+    appendNumber(response, size);
+    response.push_back('\n');
+    for (IndexType i = 1; i < size + 1; i++) {
+      appendNumber(response, values.maxDepth[i]);
+      response.push_back(' ');
+      appendNumber(response, values.maxSpeed[i]);
+      response.push_back(' ');
+      appendNumber(response, values.arrivalTime[i]);
+      response.push_back('\n');
+    }
+  }
+
+  const Tools::HealthCheck::Report report = Tools::HealthCheck::scan(h.data() - 1, hu.data() - 1, size);
+  if (!report.healthy) {
+    response.append("ERROR unphysical state in cell ");
+    appendNumber(response, report.firstBadCell);
+    response.push_back('\n');
+  } else {
+    const Blocks::Diagnostics& diagnostics = simulation->getBlock().getDiagnostics();
+    response.append("SUMMARY steps=");
+    appendNumber(response, numSteps);
+    response.append(" time=");
+    appendNumber(response, simulation->getTime());
+    response.append(" mass=");
+    appendNumber(response, diagnostics.mass);
+    response.append(" momentum=");
+    appendNumber(response, diagnostics.momentum);
+    response.append(" maxHeight=");
+    appendNumber(response, diagnostics.maxHeight);
+    response.append(" maxSpeed=");
+    appendNumber(response, diagnostics.maxSpeed);
+    response.append(" front=");
+    appendNumber(response, simulation->getFrontPosition(diagnostics));
+    response.append(" seconds=");
+    appendNumber(response, finished - start);
+    response.push_back('\n');
+  }
+  response.append("END\n");
+  sendAll(connection, response);
+
+  record(start - received, now() - received);
+
+  simulation->setBoundaryConditions(nullptr, nullptr);
+  delete leftBoundary;
+  delete rightBoundary;
+
+  return true;
+}
+
+void Runners::SimulationServer::record(double dispatchLatency, double totalLatency) {
+  std::lock_guard<std::mutex> lock(latencyMutex_);
+  if (dispatchLatencies_.size() < LatencyWindow) {
+    dispatchLatencies_.push_back(dispatchLatency);
+    totalLatencies_.push_back(totalLatency);
+  } else {
+    // Replace the oldest sample
+    dispatchLatencies_[numRequests_ % LatencyWindow] = dispatchLatency;
+    totalLatencies_[numRequests_ % LatencyWindow]    = totalLatency;
+  }
+  numRequests_++;
+}
+
+Runners::SimulationServer::Latencies Runners::SimulationServer::computePercentiles(std::vector<double> latencies, std::size_t count) {
+  if (latencies.empty()) {
+    return {0, 0, 0, 0, 0};
+  }
+
+  std::sort(latencies.begin(), latencies.end());
+
+  // Nearest rank
+  const auto percentile = [&latencies](double p) {
+    const std::size_t rank = static_cast<std::size_t>(std::ceil(p * double(latencies.size())));
+    return latencies[std::clamp<std::size_t>(rank, 1, latencies.size()) - 1];
+  };
+
+  return {count, percentile(0.5), percentile(0.9), percentile(0.99), latencies.back()};
+}
+
+unsigned int Runners::SimulationServer::getNumWorkers() const { return static_cast<unsigned int>(workers_.size()); }
+
+Runners::SimulationServer::Latencies Runners::SimulationServer::getDispatchLatencies() const {
+  std::unique_lock<std::mutex> lock(latencyMutex_);
+  std::vector<double>          latencies = dispatchLatencies_;
+  const std::size_t            count     = numRequests_;
+  lock.unlock();
+
+  return computePercentiles(std::move(latencies), count);
+}
+
+Runners::SimulationServer::Latencies Runners::SimulationServer::getTotalLatencies() const {
+  std::unique_lock<std::mutex> lock(latencyMutex_);
+  std::vector<double>          latencies = totalLatencies_;
+  const std::size_t            count     = numRequests_;
+  lock.unlock();
+
+  return computePercentiles(std::move(latencies), count);
+}
@@ -0,0 +1,167 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "SWE1DExport.hpp"
+#include "Tools/IndexType.hpp"
+
+namespace Runners {
+
+  /**
+   * A long-lived server that runs dam break simulations on request
+   *
+   * Listens on a UNIX-domain stream socket. Accepted connections are queued
+   * and served by a pool of worker threads, each connection by one worker
+   * until the client closes it. Every worker keeps its simulation (and its
+   * response buffer) between requests and only reallocates if the domain
+   * size changes, so a request of the same size starts without any
+   * allocation.
+   *
+   * Protocol (one request per line, every response ends with "END"):
+   * <pre>
+   *   RUN size=N (end=T | steps=N) [left=H] [right=H] [left-boundary=TYPE] [right-boundary=TYPE]
+   *       [friction=LAW:COEFF] [output=summary,field,envelope] [interval=N]
+   *     -> FRAME time=T size=N, followed by N lines "h hu" (every interval-th
+   *        step and at the end if the field is requested, sent immediately)
+   *        ENVELOPE size=N, followed by N lines "maxDepth maxSpeed arrivalTime"
+   *        SUMMARY steps=.. time=.. mass=.. momentum=.. maxHeight=.. maxSpeed=..
+   *          front=.. seconds=..
+   *   STATS
+   *     -> STATS requests=.. dispatch_p50=.. dispatch_p90=.. dispatch_p99=.. dispatch_max=..
+   *          total_p50=.. total_p90=.. total_p99=.. total_max=.. (in microseconds)
+   *   SHUTDOWN
+   *     -> OK, the server stops after the running requests
+   * </pre>
+   * left and right are the initial water heights of the dam break (default
+   * 15 and 10), the boundary types are outflow, reflective or periodic.
+   * Invalid requests are answered with "ERROR message".
+   *
+   * The dispatch latency is the time from the complete request line to the
+   * start of the first time step, the total latency ends with the last
+   * byte of the response. The percentiles cover the last LatencyWindow
+   * requests, so the statistics of a long-running server use bounded memory.
+   */
+  class SWE1D_EXPORT SimulationServer {
+  public:
+    /** Number of recent requests the latency percentiles are computed from */
+    static constexpr std::size_t LatencyWindow = 4096;
+
+    /** Latency percentiles in seconds */
+    struct Latencies {
+      /** Number of all finished requests */
+      std::size_t count;
+      double      p50;
+      double      p90;
+      double      p99;
+      double      max;
+    };
+
+  private:
+    class Worker;
+
+    std::string socketPath_;
+    int         socket_;
+
+    std::vector<Worker*>     workers_;
+    std::vector<std::thread> threads_;
+
+    /** Accepted connections waiting for a worker */
+    std::deque<int>         connections_;
+    std::mutex              mutex_;
+    std::condition_variable condition_;
+    std::atomic<bool>       stopping_;
+
+    /** Latencies of the last LatencyWindow requests, ring buffers indexed by numRequests_ % LatencyWindow */
+    std::vector<double> dispatchLatencies_;
+    std::vector<double> totalLatencies_;
+    std::size_t         numRequests_;
+    mutable std::mutex  latencyMutex_;
+
+    void serve(Worker& worker);
+
+    /**
+     * Handles one request line and sends the response
+     *
+     * @return False if the server should stop
+     */
+    bool handle(Worker& worker, int connection, const std::string& request, double received);
+
+    void record(double dispatchLatency, double totalLatency);
+
+    static Latencies computePercentiles(std::vector<double> latencies, std::size_t count);
+
+  public:
+    /**
+     * Binds the socket (an existing file at socketPath is replaced) and starts the workers
+     *
+     * @param numWorkers Number of worker threads (0 = all cores)
+     * @param warmSize Domain size the workers allocate in advance (0 = none)
+     */
+    SimulationServer(const std::string& socketPath, unsigned int numWorkers = 0, IndexType warmSize = 0);
+    /**
+     * Stops the server and removes the socket file
+     */
+    ~SimulationServer();
+
+    SimulationServer(const SimulationServer&)            = delete;
+    SimulationServer& operator=(const SimulationServer&) = delete;
+
+    /**
+     * Accepts connections until stop() is called or a SHUTDOWN request arrives
+     */
+    void run();
+
+    /**
+     * Makes run() return, can be called from any thread
+     */
+    void stop();
+
+    unsigned int getNumWorkers() const;
+
+    Latencies getDispatchLatencies() const;
+    Latencies getTotalLatencies() const;
+  };
+
+} // namespace Runners
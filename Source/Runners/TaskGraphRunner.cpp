@@ -0,0 +1,210 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#include "TaskGraphRunner.hpp"
+
+#include <algorithm>
+#include <span>
+#include <thread>
+#include <utility>
+
+#include "Tools/Logger.hpp"
+
+Runners::TaskGraphRunner::TaskGraphRunner(Simulation& simulation, unsigned int numThreads, IndexType chunkSize):
+  simulation_(simulation),
+  graph_(numThreads > 0 ? numThreads : std::max(std::thread::hardware_concurrency(), 1u)),
+  dt_(0),
+  numOutputs_(0) {
+
+  const IndexType size = simulation.getSize();
+  chunkSize            = std::max<IndexType>(chunkSize, 1);
+
+  for (IndexType begin = 1; begin < size + 1; begin += chunkSize) {
+    chunkBounds_.push_back(begin);
+  }
+  chunkBounds_.push_back(size + 1);
+
+  maxWaveSpeeds_.resize(getNumChunks());
+  diagnostics_.resize(getNumChunks());
+
+  for (Snapshot& snapshot : snapshots_) {
+    snapshot.h.assign(size + 2, RealType(0.0));
+    snapshot.hu.assign(size + 2, RealType(0.0));
+    snapshot.writeTask = 0;
+    snapshot.used      = false;
+  }
+}
+
+unsigned int Runners::TaskGraphRunner::getNumChunks() const { return static_cast<unsigned int>(chunkBounds_.size() - 1); }
+
+void Runners::TaskGraphRunner::run(unsigned int numSteps, unsigned int batchSize) {
+  using TaskId = Tools::TaskGraph::TaskId;
+
+  const unsigned int numChunks = getNumChunks();
+  batchSize                    = std::max(batchSize, 1u);
+
+  Blocks::WavePropagationBlock& block = simulation_.getBlock();
+
+  for (unsigned int first = 0; first < numSteps; first += batchSize) {
+    const unsigned int batchSteps = std::min(batchSize, numSteps - first);
+
+    // The time of each step is recorded by the bookkeeping task for the writer task
+    std::vector<double> times(batchSteps);
+
+    graph_.clear();
+    for (Snapshot& snapshot : snapshots_) {
+      snapshot.used = false;
+    }
+
+    std::vector<TaskId> update(numChunks);
+    std::vector<TaskId> copy(numChunks);
+    bool                hasCopy   = false;
+    TaskId              complete  = 0;
+    TaskId              lastWrite = 0;
+    bool                hasWrite  = false;
+
+    for (unsigned int s = 0; s < batchSteps; s++) {
+      const unsigned int step = simulation_.getStep() + s + 1;
+
+      // Boundary: reads the outermost inner cells and the time of the previous step
+      std::vector<TaskId> dependencies;
+      if (s > 0) {
+        dependencies = {update.front(), update.back(), complete};
+      }
+      const TaskId boundary = graph_.addTask([this, &block] { block.applyBoundaryConditions(simulation_.getTime()); }, dependencies);
+
+      // Fluxes: the edges of a chunk are the left edges of its cells (plus the
+      // right boundary edge for the last chunk), they read the left neighbour
+      std::vector<TaskId> flux(numChunks);
+      for (unsigned int k = 0; k < numChunks; k++) {
+        dependencies.clear();
+        if (k == 0 || k == numChunks - 1) {
+          dependencies.push_back(boundary);
+        }
+        if (s > 0) {
+          dependencies.push_back(update[k]);
+          if (k > 0) {
+            dependencies.push_back(update[k - 1]);
+          }
+        }
+
+        const IndexType begin = chunkBounds_[k] - 1;
+        const IndexType end   = k == numChunks - 1 ? chunkBounds_[k + 1] : chunkBounds_[k + 1] - 1;
+        flux[k]               = graph_.addTask([this, &block, k, begin, end] { maxWaveSpeeds_[k] = block.computeNumericalFluxes(begin, end); }, dependencies);
+      }
+
+      // Time step: also waits for the bookkeeping of the previous step
+      dependencies = flux;
+      if (s > 0) {
+        dependencies.push_back(complete);
+      }
+      const TaskId reduce = graph_.addTask(
+        [this, &block] { dt_ = block.getMaxTimeStep(*std::max_element(maxWaveSpeeds_.begin(), maxWaveSpeeds_.end())); }, dependencies
+      );
+
+      // Update: must not overwrite a chunk before it was copied for the output
+      for (unsigned int k = 0; k < numChunks; k++) {
+        dependencies = {reduce};
+        if (hasCopy) {
+          dependencies.push_back(copy[k]);
+        }
+
+        update[k] = graph_.addTask(
+          [this, &block, k] {
+            diagnostics_[k] = Blocks::Diagnostics();
+            block.updateUnknowns(dt_, chunkBounds_[k], chunkBounds_[k + 1], &diagnostics_[k], simulation_.getTime() + dt_);
+          },
+          dependencies
+        );
+      }
+
+      complete = graph_.addTask(
+        [this, &times, s, step] {
+          Blocks::Diagnostics diagnostics;
+          for (const Blocks::Diagnostics& partial : diagnostics_) {
+            diagnostics.combine(partial);
+          }
+
+          Tools::Logger::logger
+            << "Computing iteration " << step - 1 << " at time " << simulation_.getTime() << " with max. timestep " << dt_ << std::endl;
+
+          simulation_.completeStep(dt_, diagnostics);
+          times[s] = simulation_.getTime();
+        },
+        update
+      );
+
+      // Output: copy each chunk as soon as it is updated, write in the background
+      hasCopy = simulation_.isOutputStep(step);
+      if (hasCopy) {
+        Snapshot& snapshot = snapshots_[numOutputs_ % 2];
+        numOutputs_++;
+
+        for (unsigned int k = 0; k < numChunks; k++) {
+          dependencies = {update[k]};
+          if (snapshot.used) {
+            dependencies.push_back(snapshot.writeTask);
+          }
+
+          copy[k] = graph_.addTask(
+            [this, &snapshot, k] {
+              const std::span<const RealType> h  = std::as_const(simulation_).getHeight();
+              const std::span<const RealType> hu = std::as_const(simulation_).getMomentum();
+              std::copy(h.begin() + chunkBounds_[k] - 1, h.begin() + chunkBounds_[k + 1] - 1, snapshot.h.begin() + chunkBounds_[k]);
+              std::copy(hu.begin() + chunkBounds_[k] - 1, hu.begin() + chunkBounds_[k + 1] - 1, snapshot.hu.begin() + chunkBounds_[k]);
+            },
+            dependencies
+          );
+        }
+
+        dependencies = copy;
+        dependencies.push_back(complete);
+        if (hasWrite) {
+          dependencies.push_back(lastWrite);
+        }
+
+        lastWrite = graph_.addTask(
+          [this, &snapshot, &times, s, step] { simulation_.writeOutput(step, times[s], snapshot.h.data(), snapshot.hu.data()); }, dependencies
+        );
+        hasWrite = true;
+
+        snapshot.writeTask = lastWrite;
+        snapshot.used      = true;
+      }
+    }
+
+    graph_.run();
+  }
+}
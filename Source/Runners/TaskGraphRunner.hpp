@@ -0,0 +1,108 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "Blocks/Diagnostics.hpp"
+#include "Runners/Simulation.hpp"
+#include "SWE1DExport.hpp"
+#include "Tools/IndexType.hpp"
+#include "Tools/RealType.hpp"
+#include "Tools/TaskGraph.hpp"
+
+namespace Runners {
+
+  /**
+   * Runs a simulation as a pipelined graph of tasks
+   *
+   * The domain is split into chunks. Each step consists of a boundary task,
+   * a flux task per chunk, a time step reduction, an update task per chunk
+   * and a bookkeeping task. Tasks only wait for the chunks they actually
+   * read, e.g. the fluxes of a chunk in step n+1 start as soon as the chunk
+   * and its left neighbour are updated in step n. For output steps, the
+   * chunks are copied into one of two snapshot buffers and written by a
+   * separate task that overlaps with the following steps.
+   */
+  class SWE1D_EXPORT TaskGraphRunner {
+  private:
+    struct Snapshot {
+      std::vector<RealType> h;
+      std::vector<RealType> hu;
+      unsigned int          step;
+      double                time;
+      /** Writer task of the last output that used this buffer */
+      Tools::TaskGraph::TaskId writeTask;
+      bool                     used;
+    };
+
+    Simulation& simulation_;
+
+    Tools::TaskGraph graph_;
+
+    /** First cell (1-based) of each chunk plus the end of the domain */
+    std::vector<IndexType> chunkBounds_;
+
+    /** Maximum wave speed of each chunk in the current step */
+    std::vector<RealType> maxWaveSpeeds_;
+    /** Partial diagnostics of each chunk in the current step */
+    std::vector<Blocks::Diagnostics> diagnostics_;
+
+    /** Time step of the current step */
+    RealType dt_;
+
+    Snapshot     snapshots_[2];
+    unsigned int numOutputs_;
+
+    unsigned int getNumChunks() const;
+
+  public:
+    /**
+     * @param numThreads Number of threads (including the calling thread)
+     * @param chunkSize Number of cells per task
+     */
+    TaskGraphRunner(Simulation& simulation, unsigned int numThreads, IndexType chunkSize = 16384);
+
+    /**
+     * Does numSteps time steps
+     *
+     * @param batchSize Number of steps per task graph, the graphs of two
+     *  batches do not overlap
+     */
+    void run(unsigned int numSteps, unsigned int batchSize = 64);
+  };
+
+} // namespace Runners
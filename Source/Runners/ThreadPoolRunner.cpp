@@ -0,0 +1,251 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#include "ThreadPoolRunner.hpp"
+
+#include <algorithm>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "Tools/Logger.hpp"
+
+namespace {
+
+  /** Number of polls before a waiting thread yields its core */
+  constexpr unsigned int SpinCount = 1024;
+
+  /**
+   * Waits until a (monotone) sequence counter reaches value
+   */
+  inline void waitFor(const std::atomic<unsigned int>& counter, unsigned int value) {
+    for (unsigned int i = 0; counter.load(std::memory_order_acquire) < value; i++) {
+      if (i >= SpinCount) {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  unsigned int getPoolSize(unsigned int numThreads, IndexType size) {
+    if (numThreads == 0) {
+      numThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    // Every thread needs at least one cell
+    return static_cast<unsigned int>(std::max<IndexType>(std::min<IndexType>(numThreads, size), 1));
+  }
+
+} // namespace
+
+Runners::ThreadPoolRunner::ThreadPoolRunner(Simulation& simulation, unsigned int numThreads, bool pin):
+  simulation_(simulation),
+  numThreads_(getPoolSize(numThreads, simulation.getSize())),
+  numRounds_(0),
+  updated_(numThreads_),
+  diagnostics_(numThreads_),
+  epoch_(0),
+  startTime_(0),
+  startStep_(0),
+  numSteps_(0),
+  barrier_(numThreads_),
+  generation_(0),
+  finished_(false) {
+
+  while ((1u << numRounds_) < numThreads_) {
+    numRounds_++;
+  }
+  mailboxes_ = std::vector<Mailbox>(2 * numRounds_ * numThreads_);
+
+  const IndexType size = simulation.getSize();
+  for (unsigned int i = 0; i < numThreads_ + 1; i++) {
+    sliceBounds_.push_back(1 + size * i / numThreads_);
+  }
+
+  for (unsigned int i = 1; i < numThreads_; i++) {
+    workers_.emplace_back(&ThreadPoolRunner::work, this, i);
+
+#ifdef __linux__
+    if (pin) {
+      // Pinning is only a hint, the pool works without it
+      cpu_set_t cpus;
+      CPU_ZERO(&cpus);
+      CPU_SET(i % std::max(std::thread::hardware_concurrency(), 1u), &cpus);
+      pthread_setaffinity_np(workers_.back().native_handle(), sizeof(cpus), &cpus);
+    }
+#else
+    (void)pin;
+#endif
+  }
+}
+
+Runners::ThreadPoolRunner::~ThreadPoolRunner() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    finished_ = true;
+  }
+  condition_.notify_all();
+
+  for (std::thread& worker : workers_) {
+    worker.join();
+  }
+}
+
+void Runners::ThreadPoolRunner::run(unsigned int numSteps) {
+  startTime_ = simulation_.getTime();
+  startStep_ = simulation_.getStep();
+  numSteps_  = numSteps;
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    generation_++;
+  }
+  condition_.notify_all();
+
+  runSlice(0);
+
+  // Wait for all threads before the next run may change the parameters
+  barrier_.arrive_and_wait();
+
+  epoch_ += numSteps;
+}
+
+unsigned int Runners::ThreadPoolRunner::getNumThreads() const { return numThreads_; }
+
+void Runners::ThreadPoolRunner::work(unsigned int worker) {
+  unsigned int generation = 0;
+
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      condition_.wait(lock, [this, generation] { return finished_ || generation_ != generation; });
+      if (finished_) {
+        return;
+      }
+      generation = generation_;
+    }
+
+    runSlice(worker);
+    barrier_.arrive_and_wait();
+  }
+}
+
+void Runners::ThreadPoolRunner::runSlice(unsigned int worker) {
+  Blocks::WavePropagationBlock& block = simulation_.getBlock();
+
+  const unsigned int last  = numThreads_ - 1;
+  const IndexType    begin = sliceBounds_[worker];
+  const IndexType    end   = sliceBounds_[worker + 1];
+  // The last slice also owns the edge to the right ghost cell
+  const IndexType edgeEnd = worker == last ? end : end - 1;
+
+  double time = startTime_;
+
+  for (unsigned int i = 0; i < numSteps_; i++) {
+    const unsigned int sequence = epoch_ + i + 1;
+    const unsigned int step     = startStep_ + i + 1;
+
+    // The fluxes read the last cell of the left neighbour and overwrite the
+    // edge it used in its last update
+    if (worker > 0) {
+      waitFor(updated_[worker - 1].value, sequence - 1);
+    }
+
+    // Boundary conditions may read the other end of the domain (e.g. periodic)
+    if (worker == 0) {
+      waitFor(updated_[last].value, sequence - 1);
+      block.applyBoundaryCondition(Blocks::BoundaryCondition::LEFT, time);
+    }
+    if (worker == last) {
+      waitFor(updated_[0].value, sequence - 1);
+      block.applyBoundaryCondition(Blocks::BoundaryCondition::RIGHT, time);
+    }
+
+    // After the all-reduce, all fluxes of this step are computed
+    const RealType maxWaveSpeed = allReduceMax(worker, sequence, block.computeNumericalFluxes(begin - 1, edgeEnd));
+    const RealType dt           = block.getMaxTimeStep(maxWaveSpeed);
+
+    diagnostics_[worker] = Blocks::Diagnostics();
+    block.updateUnknowns(dt, begin, end, &diagnostics_[worker], time + dt);
+
+    updated_[worker].value.store(sequence, std::memory_order_release);
+
+    const bool synchronous = simulation_.isSynchronousStep(step);
+    if (synchronous) {
+      barrier_.arrive_and_wait();
+    }
+
+    if (worker == 0) {
+      Tools::Logger::logger << "Computing iteration " << step - 1 << " at time " << time << " with max. timestep " << dt << std::endl;
+
+      Blocks::Diagnostics diagnostics;
+      if (synchronous) {
+        for (const Blocks::Diagnostics& partial : diagnostics_) {
+          diagnostics.combine(partial);
+        }
+      }
+
+      simulation_.completeStep(dt, diagnostics);
+      if (synchronous) {
+        simulation_.writeOutput(step);
+      }
+    }
+
+    if (synchronous) {
+      barrier_.arrive_and_wait();
+    }
+
+    time += dt;
+  }
+}
+
+RealType Runners::ThreadPoolRunner::allReduceMax(unsigned int worker, unsigned int sequence, RealType value) {
+  // Messages of two consecutive steps use different mailboxes: a thread can
+  // only be one all-reduce ahead of the slowest reader
+  Mailbox* mailboxes = mailboxes_.data() + (sequence % 2) * numRounds_ * numThreads_;
+
+  for (unsigned int round = 0, distance = 1; round < numRounds_; round++, distance *= 2) {
+    Mailbox& outgoing = mailboxes[round * numThreads_ + (worker + distance) % numThreads_];
+    outgoing.value    = value;
+    outgoing.sequence.store(sequence, std::memory_order_release);
+
+    Mailbox& incoming = mailboxes[round * numThreads_ + worker];
+    waitFor(incoming.sequence, sequence);
+    value = std::max(value, incoming.value);
+  }
+
+  return value;
+}
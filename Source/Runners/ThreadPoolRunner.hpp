@@ -0,0 +1,141 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#pragma once
+
+#include <atomic>
+#include <barrier>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Blocks/Diagnostics.hpp"
+#include "Runners/Simulation.hpp"
+#include "SWE1DExport.hpp"
+#include "Tools/IndexType.hpp"
+#include "Tools/RealType.hpp"
+
+namespace Runners {
+
+  /**
+   * Runs a simulation on a persistent pool of (pinned) threads
+   *
+   * Each thread owns a slice of the domain for the whole run and computes
+   * the fluxes on the left edges of its cells. Between two steps, a thread
+   * only waits for the update of its left neighbour (and the threads at
+   * the ends of the domain for each other, as a boundary condition may read
+   * the other end). The only global communication per step is the
+   * all-reduce of the maximum wave speed, done as a dissemination exchange
+   * of lock-free messages in log2(#threads) rounds. A full barrier is only
+   * used in steps with a health check, diagnostics or output.
+   */
+  class SWE1D_EXPORT ThreadPoolRunner {
+  private:
+    /** Number of completed steps of a thread (on its own cache line) */
+    struct alignas(64) Counter {
+      std::atomic<unsigned int> value{0};
+    };
+
+    /** Message of one all-reduce round */
+    struct alignas(64) Mailbox {
+      std::atomic<unsigned int> sequence{0};
+      RealType                  value{0};
+    };
+
+    Simulation& simulation_;
+
+    unsigned int numThreads_;
+    /** Number of rounds of the all-reduce */
+    unsigned int numRounds_;
+
+    /** First cell (1-based) of each slice plus the end of the domain */
+    std::vector<IndexType> sliceBounds_;
+
+    std::vector<Counter> updated_;
+    /** Mailboxes [parity of the step][round][receiving thread] */
+    std::vector<Mailbox> mailboxes_;
+
+    /** Partial diagnostics of each slice in the current step */
+    std::vector<Blocks::Diagnostics> diagnostics_;
+
+    /** Steps done by the pool, the sequence numbers of the counters and messages */
+    unsigned int epoch_;
+
+    /** State of the simulation at the start of run() */
+    double       startTime_;
+    unsigned int startStep_;
+    unsigned int numSteps_;
+
+    std::barrier<> barrier_;
+
+    std::mutex               mutex_;
+    std::condition_variable  condition_;
+    unsigned int             generation_;
+    bool                     finished_;
+    std::vector<std::thread> workers_;
+
+    void work(unsigned int worker);
+
+    /**
+     * Does all steps of run() on the slice of one thread
+     */
+    void runSlice(unsigned int worker);
+
+    /**
+     * @return The maximum of value over all threads
+     */
+    RealType allReduceMax(unsigned int worker, unsigned int sequence, RealType value);
+
+  public:
+    /**
+     * @param numThreads Number of threads (including the calling thread), 0 = all cores
+     * @param pin Pin each additional thread to one core
+     */
+    ThreadPoolRunner(Simulation& simulation, unsigned int numThreads, bool pin = true);
+    ~ThreadPoolRunner();
+
+    ThreadPoolRunner(const ThreadPoolRunner&)            = delete;
+    ThreadPoolRunner& operator=(const ThreadPoolRunner&) = delete;
+
+    /**
+     * Does numSteps time steps
+     */
+    void run(unsigned int numSteps);
+
+    unsigned int getNumThreads() const;
+  };
+
+} // namespace Runners
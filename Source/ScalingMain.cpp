@@ -0,0 +1,456 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#include <algorithm>
+#include <barrier>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <getopt.h>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include "Blocks/BoundaryConditions.hpp"
+#include "Runners/Simulation.hpp"
+#include "Runners/ThreadPoolRunner.hpp"
+#include "Scenarios/DamBreakScenario.hpp"
+#include "Tools/IndexType.hpp"
+#include "Tools/Logger.hpp"
+#include "Tools/RealType.hpp"
+#include "Writers/VTKWriter.hpp"
+
+namespace {
+
+  /**
+   * Operation counts of the kernels per cell (or edge), estimated from the
+   * source: the f-wave solver needs 2 divisions for the velocities, 3 square
+   * roots and ~10 operations for the Roe averages and eigenvalues, ~12 for
+   * the flux difference, ~8 for the eigen decomposition and ~10 to split
+   * the f-waves into left/right net updates and to track the maximum speed
+   * (square roots and divisions count as one operation each)
+   */
+  constexpr double FluxFlops   = 45;
+  constexpr double UpdateFlops = 6;
+
+  /** Memory traffic without cache reuse: h, hu in and 4 net updates out per edge */
+  constexpr double FluxBytes = (2 + 4) * sizeof(RealType);
+  /** h, hu and 4 net updates in, h and hu out per cell */
+  constexpr double UpdateBytes = (6 + 2) * sizeof(RealType);
+
+  using Clock = std::chrono::steady_clock;
+
+  double getSeconds(Clock::time_point start) { return std::chrono::duration<double>(Clock::now() - start).count(); }
+
+  struct Phases {
+    double flux   = 0;
+    double update = 0;
+    double output = 0;
+    /** Bytes written by the output */
+    double outputBytes = 0;
+  };
+
+  struct Measurement {
+    IndexType    size;
+    unsigned int numThreads;
+    Phases       phases;
+    /** Total time of the bulk-synchronous steps (without output) */
+    double seconds;
+    /** Throughput of Runners::ThreadPoolRunner for comparison */
+    double poolCellsPerSecond;
+  };
+
+  std::vector<unsigned int> parseList(const std::string& list) {
+    std::vector<unsigned int> values;
+    std::istringstream        stream(list);
+    std::string               value;
+    while (std::getline(stream, value, ',')) {
+      values.push_back(static_cast<unsigned int>(std::stoul(value)));
+    }
+
+    return values;
+  }
+
+  /**
+   * Runs the phases of each step separated by barriers so that they can be timed individually
+   */
+  Phases runBulkSynchronous(Runners::Simulation& simulation, unsigned int numThreads, unsigned int numSteps, unsigned int outputInterval) {
+    Blocks::WavePropagationBlock& block = simulation.getBlock();
+    const IndexType               size  = simulation.getSize();
+
+    // Output into a scratch directory, the written bytes give the output bandwidth
+    const std::filesystem::path outputDirectory = std::filesystem::temp_directory_path() / ("SWE1D-scaling-" + std::to_string(::getpid()));
+    std::filesystem::create_directories(outputDirectory);
+
+    Phases phases;
+    {
+      Writers::VTKWriter writer((outputDirectory / "SWE1D").string(), simulation.getCellSize());
+
+      std::vector<RealType> maxWaveSpeeds(numThreads);
+      RealType              dt = 0;
+      std::barrier<>        barrier(numThreads);
+      Clock::time_point     start;
+
+      const auto work = [&](unsigned int thread) {
+        const IndexType begin = 1 + size * thread / numThreads;
+        const IndexType end   = 1 + size * (thread + 1) / numThreads;
+
+        for (unsigned int step = 1; step <= numSteps; step++) {
+          if (thread == 0) {
+            block.applyBoundaryConditions(simulation.getTime());
+            start = Clock::now();
+          }
+          barrier.arrive_and_wait();
+
+          maxWaveSpeeds[thread] = block.computeNumericalFluxes(begin - 1, thread == numThreads - 1 ? end : end - 1);
+          barrier.arrive_and_wait();
+
+          if (thread == 0) {
+            phases.flux += getSeconds(start);
+            dt    = block.getMaxTimeStep(*std::max_element(maxWaveSpeeds.begin(), maxWaveSpeeds.end()));
+            start = Clock::now();
+          }
+          barrier.arrive_and_wait();
+
+          block.updateUnknowns(dt, begin, end, nullptr);
+          barrier.arrive_and_wait();
+
+          if (thread == 0) {
+            phases.update += getSeconds(start);
+            simulation.completeStep(dt, Blocks::Diagnostics());
+
+            if (outputInterval > 0 && step % outputInterval == 0) {
+              start = Clock::now();
+              simulation.writeOutput(step);
+              phases.output += getSeconds(start);
+            }
+          }
+        }
+      };
+
+      if (outputInterval > 0) {
+        simulation.addWriter(writer, outputInterval);
+      }
+
+      std::vector<std::thread> threads;
+      for (unsigned int thread = 1; thread < numThreads; thread++) {
+        threads.emplace_back(work, thread);
+      }
+      work(0);
+      for (std::thread& thread : threads) {
+        thread.join();
+      }
+    }
+
+    for (const auto& entry : std::filesystem::directory_iterator(outputDirectory)) {
+      if (entry.path().extension() == ".vtr") {
+        phases.outputBytes += static_cast<double>(entry.file_size());
+      }
+    }
+    std::filesystem::remove_all(outputDirectory);
+
+    return phases;
+  }
+
+  Measurement measure(IndexType size, unsigned int numThreads, unsigned int numSteps, unsigned int outputInterval) {
+    Scenarios::DamBreakScenario scenario(size);
+
+    Measurement measurement;
+    measurement.size       = size;
+    measurement.numThreads = numThreads;
+
+    // The per-step log of the pool runner would dominate small domains
+    std::ostream silent(nullptr);
+    Tools::Logger::logger.setOutputStream(silent);
+
+    {
+      Runners::Simulation simulation(scenario, size);
+      simulation.setCheckInterval(0);
+      // Touch all arrays before measuring
+      simulation.step();
+      measurement.phases  = runBulkSynchronous(simulation, numThreads, numSteps, outputInterval);
+      measurement.seconds = measurement.phases.flux + measurement.phases.update;
+    }
+
+    {
+      Runners::Simulation simulation(scenario, size);
+      simulation.setCheckInterval(0);
+      Runners::ThreadPoolRunner runner(simulation, numThreads);
+      runner.run(1);
+
+      const Clock::time_point start = Clock::now();
+      runner.run(numSteps);
+      measurement.poolCellsPerSecond = double(size) * numSteps / getSeconds(start);
+    }
+
+    Tools::Logger::logger.setOutputStream(std::cout);
+
+    return measurement;
+  }
+
+  /**
+   * @return Triad bandwidth (a = b + s*c) in bytes/s
+   */
+  double measureBandwidth(unsigned int numThreads) {
+    constexpr std::size_t Size = std::size_t(1) << 24;
+
+    std::vector<double> a(Size, 0), b(Size, 1), c(Size, 2);
+
+    double best = 0;
+    for (unsigned int repeat = 0; repeat < 5; repeat++) {
+      const Clock::time_point  start = Clock::now();
+      std::vector<std::thread> threads;
+      for (unsigned int thread = 0; thread < numThreads; thread++) {
+        threads.emplace_back([&, thread] {
+          const std::size_t begin = Size * thread / numThreads;
+          const std::size_t end   = Size * (thread + 1) / numThreads;
+          for (std::size_t i = begin; i < end; i++) {
+            a[i] = b[i] + 3 * c[i];
+          }
+        });
+      }
+      for (std::thread& thread : threads) {
+        thread.join();
+      }
+      best = std::max(best, 3 * sizeof(double) * Size / getSeconds(start));
+    }
+
+    return best;
+  }
+
+  /**
+   * @return Floating point operations per second of independent multiply-add chains
+   */
+  double measureFlops(unsigned int numThreads) {
+    constexpr unsigned int NumChains     = 32;
+    constexpr unsigned int NumIterations = 1 << 22;
+
+    // The results are stored so that the loops are not optimized away
+    std::vector<double> sinks(numThreads);
+
+    const Clock::time_point  start = Clock::now();
+    std::vector<std::thread> threads;
+    for (unsigned int thread = 0; thread < numThreads; thread++) {
+      threads.emplace_back([&sinks, thread] {
+        double chains[NumChains];
+        for (unsigned int c = 0; c < NumChains; c++) {
+          chains[c] = c;
+        }
+
+        for (unsigned int i = 0; i < NumIterations; i++) {
+#pragma omp simd
+          for (unsigned int c = 0; c < NumChains; c++) {
+            chains[c] = chains[c] * 0.999999 + 1e-6;
+          }
+        }
+
+        double sum = 0;
+        for (unsigned int c = 0; c < NumChains; c++) {
+          sum += chains[c];
+        }
+        sinks[thread] = sum;
+      });
+    }
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+
+    return 2.0 * NumChains * NumIterations * numThreads / getSeconds(start);
+  }
+
+  void writePhase(std::ostream& out, const char* name, double seconds, double cells, double flops, double bytes, bool last = false) {
+    out
+      << "          \"" << name << "\": {\"seconds\": " << seconds << ", \"flopsPerSecond\": " << cells * flops / seconds
+      << ", \"bytesPerSecond\": " << cells * bytes / seconds << "}" << (last ? "" : ",") << std::endl;
+  }
+
+  void writeMeasurements(std::ostream& out, const char* name, const std::vector<Measurement>& measurements, unsigned int numSteps, bool weak, bool last) {
+    out << "  \"" << name << "\": [" << std::endl;
+
+    for (std::size_t i = 0; i < measurements.size(); i++) {
+      const Measurement& m     = measurements[i];
+      const double       cells = double(m.size) * numSteps;
+
+      // Compare with the first measurement of the same domain size (strong) or the first measurement (weak)
+      const Measurement* reference = &m;
+      for (const Measurement& other : measurements) {
+        if (weak || other.size == m.size) {
+          reference = &other;
+          break;
+        }
+      }
+
+      const double speedup    = reference->seconds / m.seconds * (weak ? double(m.size) / reference->size : 1.0);
+      const double efficiency = speedup * reference->numThreads / m.numThreads;
+
+      out
+        << "    {\"size\": " << m.size << ", \"threads\": " << m.numThreads << ", \"steps\": " << numSteps << ", \"seconds\": " << m.seconds
+        << ", \"cellsPerSecond\": " << cells / m.seconds << ", \"speedup\": " << speedup << ", \"efficiency\": " << efficiency
+        << ", \"poolCellsPerSecond\": " << m.poolCellsPerSecond << "," << std::endl
+        << "      \"phases\": {" << std::endl;
+      writePhase(out, "flux", m.phases.flux, cells, FluxFlops, FluxBytes);
+      writePhase(out, "update", m.phases.update, cells, UpdateFlops, UpdateBytes);
+      out
+        << "          \"output\": {\"seconds\": " << m.phases.output << ", \"bytes\": " << m.phases.outputBytes
+        << ", \"bytesPerSecond\": " << (m.phases.output > 0 ? m.phases.outputBytes / m.phases.output : 0) << "}" << std::endl
+        << "      }}" << (i + 1 < measurements.size() ? "," : "") << std::endl;
+    }
+
+    out << "  ]" << (last ? "" : ",") << std::endl;
+  }
+
+  void printHelpMessage(std::ostream& out) {
+    out
+      << "Usage: SWE1D-Scaling [OPTIONS...]" << std::endl
+      << "  -s, --sizes=N1,N2,...        domain sizes of the strong scaling (default 100000,1000000)" << std::endl
+      << "  -j, --threads=T1,T2,...      thread counts (default 1,2,4,... up to the number of cores)" << std::endl
+      << "  -w, --weak=N                 cells per thread of the weak scaling (default 250000, 0 = none)" << std::endl
+      << "  -t, --steps=N                time steps per measurement (default 50)" << std::endl
+      << "  -o, --output-interval=N      write VTK output every N steps to measure the output (default 10, 0 = none)" << std::endl
+      << "  -r, --report=FILE            JSON report (default SWE1D_scaling.json)" << std::endl
+      << "  -h, --help                   this help message" << std::endl;
+  }
+
+} // namespace
+
+/**
+ * Measures strong and weak scaling of the step loop and writes a JSON
+ * report with per-phase bandwidth, FLOP rate and the roofline of the machine
+ */
+int main(int argc, char** argv) {
+  const unsigned int numCores = std::max(std::thread::hardware_concurrency(), 1u);
+
+  std::vector<unsigned int> sizes = {100000, 1000000};
+  std::vector<unsigned int> threadCounts;
+  for (unsigned int t = 1; t < numCores; t *= 2) {
+    threadCounts.push_back(t);
+  }
+  threadCounts.push_back(numCores);
+
+  unsigned int weakSize       = 250000;
+  unsigned int numSteps       = 50;
+  unsigned int outputInterval = 10;
+  std::string  reportFile     = "SWE1D_scaling.json";
+
+  const struct option longOptions[] = {
+    {"sizes", required_argument, 0, 's'},
+    {"threads", required_argument, 0, 'j'},
+    {"weak", required_argument, 0, 'w'},
+    {"steps", required_argument, 0, 't'},
+    {"output-interval", required_argument, 0, 'o'},
+    {"report", required_argument, 0, 'r'},
+    {"help", no_argument, 0, 'h'},
+    {0, 0, 0, 0}};
+
+  int c, optionIndex;
+  while ((c = getopt_long(argc, argv, "s:j:w:t:o:r:h", longOptions, &optionIndex)) >= 0) {
+    switch (c) {
+    case 's':
+      sizes = parseList(optarg);
+      break;
+    case 'j':
+      threadCounts = parseList(optarg);
+      break;
+    case 'w':
+      weakSize = static_cast<unsigned int>(std::stoul(optarg));
+      break;
+    case 't':
+      numSteps = static_cast<unsigned int>(std::stoul(optarg));
+      break;
+    case 'o':
+      outputInterval = static_cast<unsigned int>(std::stoul(optarg));
+      break;
+    case 'r':
+      reportFile = optarg;
+      break;
+    case 'h':
+      printHelpMessage(std::cout);
+      return EXIT_SUCCESS;
+    default:
+      printHelpMessage(std::cerr);
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Roofline of the machine
+  Tools::Logger::logger.info("Measuring memory bandwidth and floating point rate");
+  const double bandwidth = measureBandwidth(numCores);
+  const double peakFlops = measureFlops(numCores);
+
+  std::vector<Measurement> strongScaling;
+  for (const unsigned int size : sizes) {
+    for (const unsigned int numThreads : threadCounts) {
+      Tools::Logger::logger << "Strong scaling: " << size << " cells, " << numThreads << " threads" << std::endl;
+      strongScaling.push_back(measure(size, numThreads, numSteps, outputInterval));
+    }
+  }
+
+  std::vector<Measurement> weakScaling;
+  if (weakSize > 0) {
+    for (const unsigned int numThreads : threadCounts) {
+      Tools::Logger::logger << "Weak scaling: " << weakSize << " cells per thread, " << numThreads << " threads" << std::endl;
+      weakScaling.push_back(measure(IndexType(weakSize) * numThreads, numThreads, numSteps, outputInterval));
+    }
+  }
+
+  std::ofstream out(reportFile);
+  if (!out.good()) {
+    Tools::Logger::logger.error(("Could not open report file " + reportFile).c_str());
+  }
+
+  const double fluxIntensity   = FluxFlops / FluxBytes;
+  const double updateIntensity = UpdateFlops / UpdateBytes;
+
+  out
+    << "{" << std::endl
+    << "  \"machine\": {\"cores\": " << numCores << ", \"bytesPerSecond\": " << bandwidth << ", \"flopsPerSecond\": " << peakFlops
+    << ", \"realSize\": " << sizeof(RealType) << "}," << std::endl
+    << "  \"kernels\": {" << std::endl
+    << "    \"flux\": {\"flopsPerCell\": " << FluxFlops << ", \"bytesPerCell\": " << FluxBytes << ", \"arithmeticIntensity\": " << fluxIntensity
+    << ", \"attainableFlopsPerSecond\": " << std::min(peakFlops, fluxIntensity * bandwidth) << "}," << std::endl
+    << "    \"update\": {\"flopsPerCell\": " << UpdateFlops << ", \"bytesPerCell\": " << UpdateBytes << ", \"arithmeticIntensity\": " << updateIntensity
+    << ", \"attainableFlopsPerSecond\": " << std::min(peakFlops, updateIntensity * bandwidth) << "}" << std::endl
+    << "  }," << std::endl;
+  writeMeasurements(out, "strongScaling", strongScaling, numSteps, false, false);
+  writeMeasurements(out, "weakScaling", weakScaling, numSteps, true, true);
+  out << "}" << std::endl;
+
+  Tools::Logger::logger << "Wrote " << reportFile << std::endl;
+
+  return EXIT_SUCCESS;
+}
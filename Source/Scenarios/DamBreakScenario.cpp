@@ -36,15 +36,40 @@
 
 #include "DamBreakScenario.hpp"
 
-Scenarios::DamBreakScenario::DamBreakScenario(unsigned int size):
-  size_(size) {}
+#include <algorithm>
+#include <cmath>
+
+Scenarios::DamBreakScenario::DamBreakScenario(IndexType size, RealType leftHeight, RealType rightHeight, RealType grading):
+  size_(size),
+  leftHeight_(leftHeight),
+  rightHeight_(rightHeight),
+  // The width of the cells is proportional to cosh(b*(2s-1)), which is cosh(b) at the ends
+  stretching_(std::acosh(std::max(double(grading), 1.0))) {}
 
 RealType Scenarios::DamBreakScenario::getCellSize() const { return RealType(1000) / size_; }
 
-unsigned int Scenarios::DamBreakScenario::getHeight(unsigned int pos) const {
+bool Scenarios::DamBreakScenario::isUniform() const { return stretching_ == 0.0; }
+
+double Scenarios::DamBreakScenario::getFace(IndexType i) const {
+  const double s = 2.0 * static_cast<double>(i) / static_cast<double>(size_) - 1.0;
+  return 500.0 + 500.0 * std::sinh(stretching_ * s) / std::sinh(stretching_);
+}
+
+RealType Scenarios::DamBreakScenario::getCellWidth(IndexType pos) const {
+  if (isUniform()) {
+    return getCellSize();
+  }
+
+  // Inner cell pos spans the faces pos-1 and pos, the cells right of the dam are mirrored to the left half
+  const IndexType cell = std::clamp<IndexType>(pos, 1, size_);
+  const IndexType left = std::min(cell, size_ + 1 - cell);
+  return RealType(getFace(left) - getFace(left - 1));
+}
+
+RealType Scenarios::DamBreakScenario::getHeight(IndexType pos) const {
   if (pos <= size_ / 2) {
-    return 15;
+    return leftHeight_;
   }
 
-  return 10;
+  return rightHeight_;
 }
@@ -36,27 +36,61 @@
 
 #pragma once
 
+#include "Scenarios/Scenario.hpp"
+#include "SWE1DExport.hpp"
+#include "Tools/IndexType.hpp"
 #include "Tools/RealType.hpp"
 
 namespace Scenarios {
 
-  class DamBreakScenario {
+  /**
+   * A dam in the middle of a channel of 1000m
+   *
+   * The grid can be graded towards the dam: the faces of the cells are at
+   * x(s) = 500 + 500*sinh(b*(2s-1))/sinh(b) for uniformly spaced s in [0,1],
+   * where b is chosen such that the cells at the ends are `grading` times as
+   * wide as the cells at the dam.
+   */
+  class SWE1D_EXPORT DamBreakScenario: public Scenario {
     /** Number of cells */
-    const unsigned int size_;
+    const IndexType size_;
+
+    /** Initial water height left and right of the dam */
+    const RealType leftHeight_;
+    const RealType rightHeight_;
+
+    /** Stretching b of the faces (0 = uniform grid) */
+    const double stretching_;
+
+    /**
+     * @return Position of the left face of the inner cell i (i = 0,..,size)
+     */
+    double getFace(IndexType i) const;
 
   public:
-    DamBreakScenario(unsigned int size);
-    ~DamBreakScenario() = default;
+    /**
+     * @param grading Width of the outermost cells relative to the cells at the dam (1 = uniform grid)
+     */
+    DamBreakScenario(IndexType size, RealType leftHeight = RealType(15), RealType rightHeight = RealType(10), RealType grading = RealType(1));
+    ~DamBreakScenario() override = default;
 
     /**
      * @return Cell size of one cell (= domain size/number of cells)
      */
-    RealType getCellSize() const;
+    RealType getCellSize() const override;
+
+    bool isUniform() const override;
+
+    /**
+     * @return Width of the cell at pos, the ghost cells are as wide as their neighbours
+     *  (cells at the same distance from the dam have exactly the same width)
+     */
+    RealType getCellWidth(IndexType pos) const override;
 
     /**
      * @return Initial water height at pos
      */
-    unsigned int getHeight(unsigned int pos) const;
+    RealType getHeight(IndexType pos) const override;
   };
 
 } // namespace Scenarios
@@ -36,23 +36,95 @@
 
 #include "Args.hpp"
 
+#include <cmath>
 #include <getopt.h>
+#include <stdexcept>
 
 #include "Logger.hpp"
 
+namespace {
+  /**
+   * Parses a floating point number that has to fill the whole text
+   *
+   * @return False if the text is not a number or out of range
+   */
+  bool parseNumber(const std::string& text, double& value) {
+    std::size_t length = 0;
+    try {
+      value = std::stod(text, &length);
+    } catch (const std::logic_error&) {
+      // std::invalid_argument or std::out_of_range
+      return false;
+    }
+    return length > 0 && length == text.size();
+  }
+} // namespace
+
 Tools::Args::Args(int argc, char** argv):
   size_(100),
-  timeSteps_(20.0) {
+  timeSteps_(20.0),
+  checkInterval_(10),
+  fpTraps_(false),
+  diagnosticsFile_(""),
+  outputInterval_(1),
+  probeFile_("SWE1D_probes.csv"),
+  probeInterpolation_(true),
+  compression_(Compression::NONE),
+  tolerance_(1e-3),
+  leftBoundary_("outflow"),
+  rightBoundary_("outflow"),
+  frictionLaw_(Blocks::WavePropagationBlock::NO_FRICTION),
+  frictionCoefficient_(0),
+  levelOfDetail_(NO_LOD),
+  monitor_(""),
+  monitorInterval_(10),
+  executor_(SEQUENTIAL),
+  numThreads_(0),
+  chunkSize_(16384),
+  outOfCoreFile_(""),
+  windowSize_(0),
+  trailFile_(""),
+  envelopeFile_(""),
+  envelopeInterval_(0),
+  server_(""),
+  vtkPieces_(1),
+  grading_(1) {
 
   const struct option longOptions[] = {
     {"size", required_argument, 0, 's'},
     {"time", required_argument, 0, 't'},
+    {"check-interval", required_argument, 0, 'c'},
+    {"fp-traps", no_argument, 0, 'f'},
+    {"diagnostics", required_argument, 0, 'd'},
+    {"output-interval", required_argument, 0, 'o'},
+    {"probes", required_argument, 0, 'p'},
+    {"probe-output", required_argument, 0, 'P'},
+    {"probe-nearest", no_argument, 0, 'n'},
+    {"compression", required_argument, 0, 'z'},
+    {"tolerance", required_argument, 0, 'e'},
+    {"left-boundary", required_argument, 0, 'l'},
+    {"right-boundary", required_argument, 0, 'r'},
+    {"friction", required_argument, 0, 'm'},
+    {"lod", required_argument, 0, 'L'},
+    {"monitor", required_argument, 0, 'M'},
+    {"monitor-interval", required_argument, 0, 'I'},
+    {"executor", required_argument, 0, 'x'},
+    {"threads", required_argument, 0, 'j'},
+    {"chunk-size", required_argument, 0, 'k'},
+    {"out-of-core", required_argument, 0, 'O'},
+    {"window", required_argument, 0, 'W'},
+    {"window-trail", required_argument, 0, 'w'},
+    {"envelope", required_argument, 0, 'E'},
+    {"envelope-interval", required_argument, 0, 'K'},
+    {"server", required_argument, 0, 'S'},
+    {"vtk-pieces", required_argument, 0, 'V'},
+    {"grading", required_argument, 0, 'g'},
     {"help", no_argument, 0, 'h'},
     {0, 0, 0, 0}};
 
   int                c, optionIndex;
   std::istringstream ss;
-  while ((c = getopt_long(argc, argv, "s:t:h", longOptions, &optionIndex)) >= 0) {
+  while ((c = getopt_long(argc, argv, "s:t:c:fd:o:p:P:nz:e:L:l:r:m:M:I:x:j:k:O:W:w:E:K:S:V:g:h", longOptions, &optionIndex)) >= 0) {
     switch (c) {
     case 0:
       Logger::logger.error("Could not parse command line arguments");
@@ -69,6 +141,170 @@ Tools::Args::Args(int argc, char** argv):
       ss >> timeSteps_;
       std::cout << timeSteps_ << std::endl;
       break;
+    case 'c':
+      ss.clear();
+      ss.str(optarg);
+      ss >> checkInterval_;
+      break;
+    case 'f':
+      fpTraps_ = true;
+      break;
+    case 'd':
+      diagnosticsFile_ = optarg;
+      break;
+    case 'o':
+      ss.clear();
+      ss.str(optarg);
+      ss >> outputInterval_;
+      break;
+    case 'p': {
+      // Comma separated list of positions
+      std::istringstream positions(optarg);
+      std::string        position;
+      while (std::getline(positions, position, ',')) {
+        double value = 0;
+        if (!parseNumber(position, value)) {
+          Logger::logger.error(("Invalid probe position \"" + position + "\"").c_str());
+        }
+        probes_.push_back(RealType(value));
+      }
+      break;
+    }
+    case 'P':
+      probeFile_ = optarg;
+      break;
+    case 'n':
+      probeInterpolation_ = false;
+      break;
+    case 'z':
+      if (std::string(optarg) == "none") {
+        compression_ = Compression::NONE;
+      } else if (std::string(optarg) == "lossless") {
+        compression_ = Compression::LOSSLESS;
+      } else if (std::string(optarg) == "lossy") {
+        compression_ = Compression::LOSSY;
+      } else {
+        Logger::logger.error("Unknown compression mode");
+      }
+      break;
+    case 'e':
+      ss.clear();
+      ss.str(optarg);
+      ss >> tolerance_;
+      break;
+    case 'l':
+      leftBoundary_ = optarg;
+      break;
+    case 'r':
+      rightBoundary_ = optarg;
+      break;
+    case 'm': {
+      // LAW or LAW:COEFFICIENT
+      const std::string friction(optarg);
+      const std::string law = friction.substr(0, friction.find(':'));
+      if (law == "none") {
+        frictionLaw_ = Blocks::WavePropagationBlock::NO_FRICTION;
+      } else if (law == "manning") {
+        frictionLaw_ = Blocks::WavePropagationBlock::MANNING;
+      } else if (law == "chezy") {
+        frictionLaw_ = Blocks::WavePropagationBlock::CHEZY;
+      } else {
+        Logger::logger.error("Unknown friction law");
+      }
+
+      if (frictionLaw_ != Blocks::WavePropagationBlock::NO_FRICTION) {
+        if (friction.find(':') == std::string::npos) {
+          Logger::logger.error("Missing friction coefficient");
+        }
+
+        const std::string coefficient = friction.substr(friction.find(':') + 1);
+        double            value       = 0;
+        if (!parseNumber(coefficient, value)) {
+          Logger::logger.error(("Invalid friction coefficient \"" + coefficient + "\"").c_str());
+        }
+        if (!(value > 0) || !std::isfinite(value)) {
+          Logger::logger.error("The friction coefficient must be a positive number");
+        }
+        frictionCoefficient_ = RealType(value);
+      }
+      break;
+    }
+    case 'L':
+      if (std::string(optarg) == "overview") {
+        levelOfDetail_ = LOD_OVERVIEW;
+      } else if (std::string(optarg) == "full") {
+        levelOfDetail_ = LOD_FULL;
+      } else {
+        Logger::logger.error("Unknown level-of-detail mode");
+      }
+      break;
+    case 'M':
+      monitor_ = optarg;
+      break;
+    case 'I':
+      ss.clear();
+      ss.str(optarg);
+      ss >> monitorInterval_;
+      break;
+    case 'x':
+      if (std::string(optarg) == "sequential") {
+        executor_ = SEQUENTIAL;
+      } else if (std::string(optarg) == "taskgraph") {
+        executor_ = TASKGRAPH;
+      } else if (std::string(optarg) == "pool") {
+        executor_ = POOL;
+      } else {
+        Logger::logger.error("Unknown executor");
+      }
+      break;
+    case 'j':
+      ss.clear();
+      ss.str(optarg);
+      ss >> numThreads_;
+      break;
+    case 'k':
+      ss.clear();
+      ss.str(optarg);
+      ss >> chunkSize_;
+      break;
+    case 'O':
+      outOfCoreFile_ = optarg;
+      break;
+    case 'W':
+      ss.clear();
+      ss.str(optarg);
+      ss >> windowSize_;
+      break;
+    case 'w':
+      trailFile_ = optarg;
+      break;
+    case 'E':
+      envelopeFile_ = optarg;
+      break;
+    case 'K':
+      ss.clear();
+      ss.str(optarg);
+      ss >> envelopeInterval_;
+      break;
+    case 'S':
+      server_ = optarg;
+      break;
+    case 'V':
+      ss.clear();
+      ss.str(optarg);
+      ss >> vtkPieces_;
+      if (vtkPieces_ == 0) {
+        Logger::logger.error("The number of VTK pieces must be positive");
+      }
+      break;
+    case 'g':
+      ss.clear();
+      ss.str(optarg);
+      ss >> grading_;
+      if (!(grading_ >= 1)) {
+        Logger::logger.error("The grading must be at least 1");
+      }
+      break;
     case 'h':
       printHelpMessage();
       exit(0);
@@ -84,14 +320,111 @@ Tools::Args::Args(int argc, char** argv):
   }
 }
 
-unsigned int Tools::Args::getSize() { return size_; }
+IndexType Tools::Args::getSize() { return size_; }
 
 unsigned int Tools::Args::getTimeSteps() { return timeSteps_; }
 
+unsigned int Tools::Args::getCheckInterval() { return checkInterval_; }
+
+bool Tools::Args::getFpTraps() { return fpTraps_; }
+
+const std::string& Tools::Args::getDiagnosticsFile() { return diagnosticsFile_; }
+
+unsigned int Tools::Args::getOutputInterval() { return outputInterval_; }
+
+const std::vector<RealType>& Tools::Args::getProbes() { return probes_; }
+
+const std::string& Tools::Args::getProbeFile() { return probeFile_; }
+
+bool Tools::Args::getProbeInterpolation() { return probeInterpolation_; }
+
+Tools::Compression::Mode Tools::Args::getCompression() { return compression_; }
+
+double Tools::Args::getTolerance() { return tolerance_; }
+
+const std::string& Tools::Args::getLeftBoundary() { return leftBoundary_; }
+
+const std::string& Tools::Args::getRightBoundary() { return rightBoundary_; }
+
+Blocks::WavePropagationBlock::FrictionLaw Tools::Args::getFrictionLaw() { return frictionLaw_; }
+
+RealType Tools::Args::getFrictionCoefficient() { return frictionCoefficient_; }
+
+Tools::Args::LevelOfDetail Tools::Args::getLevelOfDetail() { return levelOfDetail_; }
+
+const std::string& Tools::Args::getMonitor() { return monitor_; }
+
+unsigned int Tools::Args::getMonitorInterval() { return monitorInterval_; }
+
+Tools::Args::Executor Tools::Args::getExecutor() { return executor_; }
+
+unsigned int Tools::Args::getNumThreads() { return numThreads_; }
+
+IndexType Tools::Args::getChunkSize() { return chunkSize_; }
+
+const std::string& Tools::Args::getOutOfCoreFile() { return outOfCoreFile_; }
+
+IndexType Tools::Args::getWindowSize() { return windowSize_; }
+
+const std::string& Tools::Args::getTrailFile() { return trailFile_; }
+
+const std::string& Tools::Args::getEnvelopeFile() { return envelopeFile_; }
+
+unsigned int Tools::Args::getEnvelopeInterval() { return envelopeInterval_; }
+
+const std::string& Tools::Args::getServer() { return server_; }
+
+unsigned int Tools::Args::getVtkPieces() { return vtkPieces_; }
+
+RealType Tools::Args::getGrading() { return grading_; }
+
 void Tools::Args::printHelpMessage(std::ostream& out) {
   out
     << "Usage: SWE1D [OPTIONS...]" << std::endl
     << "  -s, --size=SIZE              domain size" << std::endl
     << "  -t, --time=TIME              number of simulated time steps" << std::endl
+    << "  -c, --check-interval=N       check for NaN/Inf and negative heights every N steps (0 = off, default 10)" << std::endl
+    << "  -f, --fp-traps               trap floating point exceptions (debugging only)" << std::endl
+    << "  -d, --diagnostics=FILE       write mass, momentum, max. height/speed and front position of every step to FILE" << std::endl
+    << "                               (CSV if FILE ends with .csv, binary records otherwise)" << std::endl
+    << "  -o, --output-interval=N      write VTK output every N steps (0 = no field output, default 1)" << std::endl
+    << "  -p, --probes=X1,X2,...       record h and hu at the given x coordinates in every step" << std::endl
+    << "  -P, --probe-output=FILE      output file of the probes (default SWE1D_probes.csv)" << std::endl
+    << "  -n, --probe-nearest          use the value of the containing cell instead of interpolating" << std::endl
+    << "  -z, --compression=MODE       write fields compressed to SWE1D.swc instead of VTK files," << std::endl
+    << "                               MODE is none (default), lossless or lossy (decode with SWE1D-Decode)" << std::endl
+    << "  -e, --tolerance=TOL          absolute error bound of the lossy compression (default 1e-3)" << std::endl
+    << "  -L, --lod=MODE               write a min/max/mean pyramid of power-of-two coarsenings to SWE1D.lod:" << std::endl
+    << "                               overview (coarse levels, in addition to the field output) or full" << std::endl
+    << "                               (all levels, replaces the field output)" << std::endl
+    << "  -l, --left-boundary=TYPE     boundary condition on the left side: outflow (default), reflective," << std::endl
+    << "                               periodic or inflow:FILE (time series \"time,h[,hu]\" if FILE ends with .csv," << std::endl
+    << "                               binary records of three doubles otherwise)" << std::endl
+    << "  -r, --right-boundary=TYPE    boundary condition on the right side (see --left-boundary)" << std::endl
+    << "  -m, --friction=LAW:COEFF     bottom friction: none (default), manning:N (e.g. manning:0.03) or chezy:C," << std::endl
+    << "                               integrated semi-implicitly (no additional time step limit)" << std::endl
+    << "  -M, --monitor=NAME           publish downsampled frames to the shared memory NAME (watch with SWE1D-Monitor)" << std::endl
+    << "  -I, --monitor-interval=N     publish every N steps (default 10)" << std::endl
+    << "  -x, --executor=TYPE          execution of the time steps: sequential (default), taskgraph (pipelined" << std::endl
+    << "                               tasks per chunk with work stealing) or pool (one slice per pinned thread," << std::endl
+    << "                               synchronized with the neighbours only)" << std::endl
+    << "  -j, --threads=N              number of threads of the parallel executors (0 = all cores, default)" << std::endl
+    << "  -k, --chunk-size=N           number of cells per task of the taskgraph executor or per chunk of the" << std::endl
+    << "                               out-of-core mode (default 16384)" << std::endl
+    << "  -O, --out-of-core=FILE       keep h and hu in the memory-mapped FILE instead of RAM and process them" << std::endl
+    << "                               chunk by chunk (for domains larger than the memory, sequential only)" << std::endl
+    << "  -W, --window=N               simulate only a window of N cells that follows the front to the right" << std::endl
+    << "                               (0 = whole domain, default; sequential only, no probes," << std::endl
+    << "                               VTK field output only, placed at the position of the window)" << std::endl
+    << "  -w, --window-trail=FILE      write the cells leaving the window losslessly compressed to FILE" << std::endl
+    << "  -E, --envelope=FILE          write the maximum depth, maximum speed and arrival time of every cell to FILE" << std::endl
+    << "                               at the end (CSV if FILE ends with .csv, binary otherwise; not with -O or -W)" << std::endl
+    << "  -K, --envelope-interval=N    also write the envelope every N steps (0 = only at the end, default)" << std::endl
+    << "  -S, --server=SOCKET          serve run requests on the UNIX-domain SOCKET with --threads workers that keep" << std::endl
+    << "                               buffers of --size cells (see Runners/SimulationServer.hpp for the protocol)" << std::endl
+    << "  -V, --vtk-pieces=N           split every VTK output into N pieces written concurrently by N threads," << std::endl
+    << "                               combined by a .pvtr file (default 1 = a single .vtr file)" << std::endl
+    << "  -g, --grading=RATIO          refine the grid towards the dam, the cells at the ends are RATIO times as wide" << std::endl
+    << "                               as the cells at the dam (default 1 = uniform; not with -O, -W, -S or probes)" << std::endl
     << "  -h, --help                   this help message" << std::endl;
 }
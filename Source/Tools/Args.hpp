@@ -39,18 +39,85 @@
 #include <cstdlib>
 #include <iostream>
 #include <sstream>
+#include <string>
+#include <vector>
+
+#include "Blocks/WavePropagationBlock.hpp"
+#include "SWE1DExport.hpp"
+#include "Tools/Compression.hpp"
+#include "Tools/IndexType.hpp"
+#include "Tools/RealType.hpp"
 
 namespace Tools {
 
   /**
    * Parse command line arguments
    */
-  class Args {
+  class SWE1D_EXPORT Args {
+  public:
+    /** How the time steps are executed */
+    enum Executor { SEQUENTIAL, TASKGRAPH, POOL };
+
+    /** Level-of-detail output: none, coarse levels only or including the full resolution */
+    enum LevelOfDetail { NO_LOD, LOD_OVERVIEW, LOD_FULL };
+
   private:
     /** Domain size */
-    unsigned int size_;
+    IndexType size_;
     /** Number of time steps we want to simulate */
     unsigned int timeSteps_;
+    /** Number of time steps between two health checks (0 = disabled) */
+    unsigned int checkInterval_;
+    /** Enable floating point exceptions (signals) for debugging */
+    bool fpTraps_;
+    /** File for the per-step diagnostics (empty = disabled) */
+    std::string diagnosticsFile_;
+    /** Number of time steps between two VTK outputs (0 = disabled) */
+    unsigned int outputInterval_;
+    /** x coordinates of the probes */
+    std::vector<RealType> probes_;
+    /** Output file of the probes */
+    std::string probeFile_;
+    /** Interpolate linearly between cell centers at the probes */
+    bool probeInterpolation_;
+    /** Compression of the field output */
+    Compression::Mode compression_;
+    /** Absolute error bound of the lossy compression */
+    double tolerance_;
+    /** Description of the boundary conditions, see Blocks::BoundaryCondition::create */
+    std::string leftBoundary_;
+    std::string rightBoundary_;
+    /** Bottom friction law and its (uniform) coefficient */
+    Blocks::WavePropagationBlock::FrictionLaw frictionLaw_;
+    RealType                                  frictionCoefficient_;
+    /** Level-of-detail pyramid output */
+    LevelOfDetail levelOfDetail_;
+    /** Name of the shared memory for live monitoring (empty = disabled) */
+    std::string monitor_;
+    /** Number of time steps between two published frames */
+    unsigned int monitorInterval_;
+    /** Execution of the time steps */
+    Executor executor_;
+    /** Number of threads of the parallel executors (0 = all cores) */
+    unsigned int numThreads_;
+    /** Number of cells per task of the task graph executor or per chunk of the out-of-core mode */
+    IndexType chunkSize_;
+    /** State file of the out-of-core mode (empty = state in memory) */
+    std::string outOfCoreFile_;
+    /** Number of cells of the moving window (0 = whole domain) */
+    IndexType windowSize_;
+    /** Output of the cells leaving the moving window (empty = dropped) */
+    std::string trailFile_;
+    /** Output of the per-cell envelope (empty = disabled) */
+    std::string envelopeFile_;
+    /** Number of time steps between two envelope checkpoints (0 = only at the end) */
+    unsigned int envelopeInterval_;
+    /** Socket of the server mode (empty = single run) */
+    std::string server_;
+    /** Number of VTK pieces written concurrently per output (1 = a single .vtr file) */
+    unsigned int vtkPieces_;
+    /** Width of the outermost cells relative to the cells at the dam (1 = uniform grid) */
+    RealType grading_;
 
     /**
      * Prints the help message, showing all available options
@@ -64,8 +131,48 @@ namespace Tools {
     Args(int argc, char** argv);
     ~Args() = default;
 
-    unsigned int getSize();
-    unsigned int getTimeSteps();
+    IndexType          getSize();
+    unsigned int       getTimeSteps();
+    unsigned int       getCheckInterval();
+    bool               getFpTraps();
+    const std::string& getDiagnosticsFile();
+    unsigned int       getOutputInterval();
+
+    const std::vector<RealType>& getProbes();
+    const std::string&           getProbeFile();
+    bool                         getProbeInterpolation();
+
+    Compression::Mode getCompression();
+    double            getTolerance();
+
+    const std::string& getLeftBoundary();
+    const std::string& getRightBoundary();
+
+    Blocks::WavePropagationBlock::FrictionLaw getFrictionLaw();
+    RealType                                  getFrictionCoefficient();
+
+    LevelOfDetail getLevelOfDetail();
+
+    const std::string& getMonitor();
+    unsigned int       getMonitorInterval();
+
+    Executor     getExecutor();
+    unsigned int getNumThreads();
+    IndexType    getChunkSize();
+
+    const std::string& getOutOfCoreFile();
+
+    IndexType          getWindowSize();
+    const std::string& getTrailFile();
+
+    const std::string& getEnvelopeFile();
+    unsigned int       getEnvelopeInterval();
+
+    const std::string& getServer();
+
+    unsigned int getVtkPieces();
+
+    RealType getGrading();
   };
 
 } // namespace Tools
@@ -0,0 +1,115 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#include "CompressedReader.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+#include "Tools/Compression.hpp"
+#include "Tools/Logger.hpp"
+
+Tools::CompressedReader::CompressedReader(const std::string& fileName):
+  file_(fileName.c_str(), std::ios::in | std::ios::binary),
+  cellSize_(1) {
+
+  char          magic[4];
+  std::uint32_t realSize = 0;
+  double        cellSize = 1;
+  file_.read(magic, sizeof(magic));
+  file_.read(reinterpret_cast<char*>(&realSize), sizeof(realSize));
+  file_.read(reinterpret_cast<char*>(&cellSize), sizeof(cellSize));
+
+  if (!file_.good() || std::memcmp(magic, "SWEC", 4) != 0) {
+    Logger::logger.error(("Not a compressed SWE1D file: " + fileName).c_str());
+  }
+  if (realSize != sizeof(RealType)) {
+    Logger::logger.error("Compressed file uses a different floating point precision");
+  }
+
+  cellSize_ = RealType(cellSize);
+}
+
+RealType Tools::CompressedReader::getCellSize() const { return cellSize_; }
+
+bool Tools::CompressedReader::readFrame(double& time, std::vector<RealType>& h, std::vector<RealType>& hu) {
+  std::uint64_t size;
+  double        tolerance;
+  if (!file_.read(reinterpret_cast<char*>(&time), sizeof(time))) {
+    return false;
+  }
+  file_.read(reinterpret_cast<char*>(&size), sizeof(size));
+  file_.read(reinterpret_cast<char*>(&tolerance), sizeof(tolerance));
+
+  if (!readField(h, size, tolerance) || !readField(hu, size, tolerance)) {
+    Logger::logger.error("Corrupt frame in compressed file");
+  }
+
+  return true;
+}
+
+bool Tools::CompressedReader::readField(std::vector<RealType>& values, std::size_t size, double tolerance) {
+  values.resize(size);
+
+  std::uint64_t numChunks;
+  if (!file_.read(reinterpret_cast<char*>(&numChunks), sizeof(numChunks))) {
+    return false;
+  }
+
+  std::vector<std::uint8_t> data;
+  std::size_t               offset = 0;
+  for (std::uint64_t chunk = 0; chunk < numChunks; chunk++) {
+    std::uint8_t  mode;
+    std::uint64_t numValues, numBytes;
+    file_.read(reinterpret_cast<char*>(&mode), sizeof(mode));
+    file_.read(reinterpret_cast<char*>(&numValues), sizeof(numValues));
+    file_.read(reinterpret_cast<char*>(&numBytes), sizeof(numBytes));
+    if (!file_.good() || offset + numValues > size) {
+      return false;
+    }
+
+    data.resize(numBytes);
+    if (!file_.read(reinterpret_cast<char*>(data.data()), numBytes)) {
+      return false;
+    }
+
+    if (!Compression::decompress(data.data(), numBytes, &values[offset], numValues, static_cast<Compression::Mode>(mode), tolerance)) {
+      return false;
+    }
+    offset += numValues;
+  }
+
+  return offset == size;
+}
@@ -0,0 +1,74 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#pragma once
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "SWE1DExport.hpp"
+#include "Tools/RealType.hpp"
+
+namespace Tools {
+
+  /**
+   * Decodes files written by Writers::CompressedWriter frame by frame
+   */
+  class SWE1D_EXPORT CompressedReader {
+  private:
+    std::ifstream file_;
+
+    RealType cellSize_;
+
+    bool readField(std::vector<RealType>& values, std::size_t size, double tolerance);
+
+  public:
+    CompressedReader(const std::string& fileName);
+    ~CompressedReader() = default;
+
+    RealType getCellSize() const;
+
+    /**
+     * Reads the next frame
+     *
+     * @param h Water height (without boundary values)
+     * @param hu Momentum (without boundary values)
+     * @return False at the end of the file
+     */
+    bool readFrame(double& time, std::vector<RealType>& h, std::vector<RealType>& hu);
+  };
+
+} // namespace Tools
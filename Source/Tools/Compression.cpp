@@ -0,0 +1,324 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#include "Compression.hpp"
+
+#include <cmath>
+#include <cstring>
+
+namespace {
+  /** Minimal length of a match */
+  constexpr std::size_t MinMatch = 4;
+  /** The last bytes are always stored as literals (no match reads past the end) */
+  constexpr std::size_t LastLiterals = 8;
+  /** Matches are referenced by 16 bit offsets */
+  constexpr std::size_t MaxOffset = 65535;
+  constexpr unsigned int HashLog  = 16;
+
+  std::uint32_t read32(const std::uint8_t* p) {
+    std::uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+  }
+
+  std::uint32_t hash(std::uint32_t value) { return (value * 2654435761u) >> (32 - HashLog); }
+
+  void writeLength(std::vector<std::uint8_t>& out, std::size_t length) {
+    for (; length >= 255; length -= 255) {
+      out.push_back(255);
+    }
+    out.push_back(static_cast<std::uint8_t>(length));
+  }
+
+  bool readLength(const std::uint8_t*& in, const std::uint8_t* end, std::size_t& length) {
+    std::uint8_t byte;
+    do {
+      if (in == end) {
+        return false;
+      }
+      byte = *in++;
+      length += byte;
+    } while (byte == 255);
+    return true;
+  }
+
+  void writeSequence(std::vector<std::uint8_t>& out, const std::uint8_t* literals, std::size_t numLiterals, std::size_t offset, std::size_t matchLength) {
+    const std::size_t extraMatch = matchLength - MinMatch;
+
+    out.push_back(static_cast<std::uint8_t>((std::min<std::size_t>(numLiterals, 15) << 4) | std::min<std::size_t>(extraMatch, 15)));
+    if (numLiterals >= 15) {
+      writeLength(out, numLiterals - 15);
+    }
+    out.insert(out.end(), literals, literals + numLiterals);
+
+    out.push_back(static_cast<std::uint8_t>(offset));
+    out.push_back(static_cast<std::uint8_t>(offset >> 8));
+    if (extraMatch >= 15) {
+      writeLength(out, extraMatch - 15);
+    }
+  }
+
+  std::uint64_t zigzag(std::int64_t value) { return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63); }
+
+  std::int64_t unzigzag(std::uint64_t value) { return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1); }
+} // namespace
+
+std::vector<std::uint8_t> Tools::Compression::compress(const RealType* values, std::size_t numValues, Mode mode, double tolerance, Mode& usedMode) {
+  if (mode == LOSSY && tolerance > 0.0) {
+    const double step = 2.0 * tolerance;
+
+    // Quantize, delta encode and pack as zigzag varints
+    std::vector<std::uint8_t> packed;
+    packed.reserve(numValues * 2);
+
+    bool         representable = true;
+    std::int64_t previous      = 0;
+    for (std::size_t i = 0; i < numValues; i++) {
+      const double scaled = values[i] / step;
+      // Also false for NaN
+      if (!(std::fabs(scaled) < 0x1p61)) {
+        representable = false;
+        break;
+      }
+
+      const std::int64_t quantized = std::llround(scaled);
+      std::uint64_t      delta     = zigzag(quantized - previous);
+      previous                     = quantized;
+
+      while (delta >= 0x80) {
+        packed.push_back(static_cast<std::uint8_t>(delta | 0x80));
+        delta >>= 7;
+      }
+      packed.push_back(static_cast<std::uint8_t>(delta));
+    }
+
+    if (representable) {
+      usedMode = LOSSY;
+
+      // The size of the packed integers is stored in front of the compressed data
+      const std::uint64_t       packedBytes = packed.size();
+      std::vector<std::uint8_t> compressed  = lzCompress(packed.data(), packed.size());
+      compressed.insert(compressed.begin(), reinterpret_cast<const std::uint8_t*>(&packedBytes), reinterpret_cast<const std::uint8_t*>(&packedBytes + 1));
+      return compressed;
+    }
+  }
+
+  if (mode == NONE) {
+    usedMode = NONE;
+    const std::uint8_t* bytes = reinterpret_cast<const std::uint8_t*>(values);
+    return std::vector<std::uint8_t>(bytes, bytes + numValues * sizeof(RealType));
+  }
+
+  usedMode = LOSSLESS;
+  std::vector<std::uint8_t> shuffled(numValues * sizeof(RealType));
+  shuffle(reinterpret_cast<const std::uint8_t*>(values), numValues, sizeof(RealType), shuffled.data());
+  return lzCompress(shuffled.data(), shuffled.size());
+}
+
+bool Tools::Compression::decompress(const std::uint8_t* data, std::size_t numBytes, RealType* values, std::size_t numValues, Mode mode, double tolerance) {
+  switch (mode) {
+  case NONE:
+    if (numBytes != numValues * sizeof(RealType)) {
+      return false;
+    }
+    std::memcpy(values, data, numBytes);
+    return true;
+  case LOSSLESS: {
+    std::vector<std::uint8_t> shuffled(numValues * sizeof(RealType));
+    if (!lzDecompress(data, numBytes, shuffled.data(), shuffled.size())) {
+      return false;
+    }
+    unshuffle(shuffled.data(), numValues, sizeof(RealType), reinterpret_cast<std::uint8_t*>(values));
+    return true;
+  }
+  case LOSSY: {
+    std::uint64_t packedBytes;
+    if (numBytes < sizeof(packedBytes)) {
+      return false;
+    }
+    std::memcpy(&packedBytes, data, sizeof(packedBytes));
+    // A varint takes at most 10 bytes
+    if (packedBytes > numValues * 10) {
+      return false;
+    }
+
+    std::vector<std::uint8_t> packed(packedBytes);
+    if (!lzDecompress(data + sizeof(packedBytes), numBytes - sizeof(packedBytes), packed.data(), packed.size())) {
+      return false;
+    }
+
+    const double        step     = 2.0 * tolerance;
+    const std::uint8_t* in       = packed.data();
+    const std::uint8_t* end      = in + packedBytes;
+    std::int64_t        previous = 0;
+    for (std::size_t i = 0; i < numValues; i++) {
+      std::uint64_t delta = 0;
+      unsigned int  shift = 0;
+      std::uint8_t  byte;
+      do {
+        if (in == end || shift > 63) {
+          return false;
+        }
+        byte = *in++;
+        delta |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+        shift += 7;
+      } while (byte & 0x80);
+
+      previous += unzigzag(delta);
+      values[i] = static_cast<RealType>(static_cast<double>(previous) * step);
+    }
+    return true;
+  }
+  }
+
+  return false;
+}
+
+void Tools::Compression::shuffle(const std::uint8_t* in, std::size_t numElements, std::size_t elementSize, std::uint8_t* out) {
+  for (std::size_t i = 0; i < numElements; i++) {
+    for (std::size_t b = 0; b < elementSize; b++) {
+      out[b * numElements + i] = in[i * elementSize + b];
+    }
+  }
+}
+
+void Tools::Compression::unshuffle(const std::uint8_t* in, std::size_t numElements, std::size_t elementSize, std::uint8_t* out) {
+  for (std::size_t i = 0; i < numElements; i++) {
+    for (std::size_t b = 0; b < elementSize; b++) {
+      out[i * elementSize + b] = in[b * numElements + i];
+    }
+  }
+}
+
+std::vector<std::uint8_t> Tools::Compression::lzCompress(const std::uint8_t* in, std::size_t numBytes) {
+  std::vector<std::uint8_t> out;
+  out.reserve(numBytes / 2 + 16);
+
+  const std::uint8_t* anchor = in;
+  const std::uint8_t* end    = in + numBytes;
+
+  if (numBytes > MinMatch + LastLiterals) {
+    // Last position (in the input) of each hashed 4 byte sequence
+    std::vector<std::uint32_t> table(std::size_t(1) << HashLog, 0);
+
+    const std::uint8_t* matchLimit = end - LastLiterals;
+    const std::uint8_t* ip         = in + 1;
+
+    while (ip + MinMatch <= matchLimit) {
+      const std::uint32_t sequence = read32(ip);
+      const std::uint32_t h        = hash(sequence);
+      const std::uint8_t* ref      = in + table[h];
+      table[h]                     = static_cast<std::uint32_t>(ip - in);
+
+      if (ref >= ip || static_cast<std::size_t>(ip - ref) > MaxOffset || read32(ref) != sequence) {
+        ip++;
+        continue;
+      }
+
+      // Extend the match
+      std::size_t length = MinMatch;
+      while (ip + length < matchLimit && ref[length] == ip[length]) {
+        length++;
+      }
+
+      writeSequence(out, anchor, static_cast<std::size_t>(ip - anchor), static_cast<std::size_t>(ip - ref), length);
+
+      ip += length;
+      anchor = ip;
+    }
+  }
+
+  // Remaining literals without a match
+  const std::size_t numLiterals = static_cast<std::size_t>(end - anchor);
+  out.push_back(static_cast<std::uint8_t>(std::min<std::size_t>(numLiterals, 15) << 4));
+  if (numLiterals >= 15) {
+    writeLength(out, numLiterals - 15);
+  }
+  out.insert(out.end(), anchor, end);
+
+  return out;
+}
+
+bool Tools::Compression::lzDecompress(const std::uint8_t* in, std::size_t numBytes, std::uint8_t* out, std::size_t outBytes) {
+  const std::uint8_t* end    = in + numBytes;
+  std::uint8_t*       op     = out;
+  std::uint8_t*       outEnd = out + outBytes;
+
+  while (in < end) {
+    const std::uint8_t token = *in++;
+
+    // Literals
+    std::size_t numLiterals = token >> 4;
+    if (numLiterals == 15 && !readLength(in, end, numLiterals)) {
+      return false;
+    }
+    if (numLiterals > static_cast<std::size_t>(end - in) || numLiterals > static_cast<std::size_t>(outEnd - op)) {
+      return false;
+    }
+    std::memcpy(op, in, numLiterals);
+    op += numLiterals;
+    in += numLiterals;
+
+    // The last sequence has no match
+    if (in == end) {
+      break;
+    }
+
+    if (end - in < 2) {
+      return false;
+    }
+    const std::size_t offset = std::size_t(in[0]) | (std::size_t(in[1]) << 8);
+    in += 2;
+
+    std::size_t length = token & 15;
+    if (length == 15 && !readLength(in, end, length)) {
+      return false;
+    }
+    length += MinMatch;
+
+    if (offset == 0 || offset > static_cast<std::size_t>(op - out) || length > static_cast<std::size_t>(outEnd - op)) {
+      return false;
+    }
+
+    // Byte-wise copy since the match may overlap with the output
+    const std::uint8_t* match = op - offset;
+    for (std::size_t i = 0; i < length; i++) {
+      op[i] = match[i];
+    }
+    op += length;
+  }
+
+  return op == outEnd;
+}
@@ -0,0 +1,96 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "SWE1DExport.hpp"
+#include "Tools/RealType.hpp"
+
+namespace Tools {
+
+  /**
+   * Self-contained codecs for field output
+   *
+   * LOSSLESS: Byte-shuffle (all first bytes of the values, then all second
+   *   bytes, ...) followed by a fast LZ77 compressor in the spirit of LZ4.
+   *   Smooth fields compress well since the exponent bytes are grouped.
+   *
+   * LOSSY: Quantization to multiples of 2*tolerance (absolute error bound
+   *   tolerance), delta encoding of the integers, zigzag/varint packing and
+   *   the LZ77 compressor. Chunks with non-finite values fall back to LOSSLESS.
+   */
+  class SWE1D_EXPORT Compression {
+  public:
+    enum Mode : std::uint8_t { NONE = 0, LOSSLESS = 1, LOSSY = 2 };
+
+    /**
+     * Compresses numValues values
+     *
+     * @param mode Requested mode, the mode actually used is returned in usedMode
+     * @param tolerance Absolute error bound (LOSSY only)
+     */
+    static std::vector<std::uint8_t> compress(const RealType* values, std::size_t numValues, Mode mode, double tolerance, Mode& usedMode);
+
+    /**
+     * Reverses compress()
+     *
+     * @param mode The mode returned by compress() in usedMode
+     * @return False if the input is corrupt
+     */
+    static bool decompress(const std::uint8_t* data, std::size_t numBytes, RealType* values, std::size_t numValues, Mode mode, double tolerance);
+
+    /**
+     * Transposes numElements elements of elementSize bytes into byte planes
+     */
+    static void shuffle(const std::uint8_t* in, std::size_t numElements, std::size_t elementSize, std::uint8_t* out);
+    static void unshuffle(const std::uint8_t* in, std::size_t numElements, std::size_t elementSize, std::uint8_t* out);
+
+    /**
+     * LZ77 compression of an arbitrary byte stream
+     */
+    static std::vector<std::uint8_t> lzCompress(const std::uint8_t* in, std::size_t numBytes);
+
+    /**
+     * @param outBytes Exact size of the uncompressed data
+     * @return False if the input is corrupt
+     */
+    static bool lzDecompress(const std::uint8_t* in, std::size_t numBytes, std::uint8_t* out, std::size_t outBytes);
+  };
+
+} // namespace Tools
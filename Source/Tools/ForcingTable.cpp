@@ -0,0 +1,146 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#include "ForcingTable.hpp"
+
+#include <algorithm>
+#include <sstream>
+
+#include "Tools/Logger.hpp"
+
+Tools::ForcingTable::ForcingTable(const std::string& fileName):
+  binary_(!fileName.ends_with(".csv")),
+  hasMomentum_(true),
+  cursor_(0) {
+
+  file_.open(fileName.c_str(), binary_ ? std::ios::in | std::ios::binary : std::ios::in);
+  if (!file_.good()) {
+    Logger::logger.error(("Could not open forcing file " + fileName).c_str());
+  }
+
+  // The first block is read synchronously, afterwards one block is always read ahead
+  records_ = readBlock(&hasMomentum_);
+  if (records_.empty()) {
+    Logger::logger.error(("Forcing file " + fileName + " contains no records").c_str());
+  }
+  nextBlock_ = std::async(std::launch::async, &ForcingTable::readBlock, this, nullptr);
+}
+
+Tools::ForcingTable::~ForcingTable() {
+  if (nextBlock_.valid()) {
+    nextBlock_.wait();
+  }
+}
+
+std::vector<Tools::ForcingTable::Record> Tools::ForcingTable::readBlock(bool* hasMomentum) {
+  std::vector<Record> block;
+  block.reserve(BlockSize);
+
+  if (binary_) {
+    block.resize(BlockSize);
+    file_.read(reinterpret_cast<char*>(block.data()), sizeof(Record) * BlockSize);
+    block.resize(static_cast<std::size_t>(file_.gcount()) / sizeof(Record));
+    return block;
+  }
+
+  std::string line;
+  while (block.size() < BlockSize && std::getline(file_, line)) {
+    std::replace(line.begin(), line.end(), ',', ' ');
+    std::istringstream ss(line);
+
+    Record record;
+    if (!(ss >> record.time >> record.h)) {
+      // Header or empty line
+      continue;
+    }
+    if (!(ss >> record.hu)) {
+      record.hu = 0;
+      if (hasMomentum) {
+        *hasMomentum = false;
+      }
+    }
+    block.push_back(record);
+  }
+
+  return block;
+}
+
+bool Tools::ForcingTable::advanceBlock() {
+  if (!nextBlock_.valid()) {
+    return false;
+  }
+
+  std::vector<Record> block = nextBlock_.get();
+  if (block.empty()) {
+    return false;
+  }
+
+  // Keep the last record to interpolate across the block boundary
+  block.insert(block.begin(), records_.back());
+  records_ = std::move(block);
+  cursor_  = 0;
+
+  nextBlock_ = std::async(std::launch::async, &ForcingTable::readBlock, this, nullptr);
+
+  return true;
+}
+
+void Tools::ForcingTable::evaluate(double time, RealType& h, RealType& hu) {
+  // Advance the cursor, usually by at most one record per time step
+  while (true) {
+    if (cursor_ + 1 < records_.size()) {
+      if (records_[cursor_ + 1].time > time) {
+        break;
+      }
+      cursor_++;
+    } else if (!advanceBlock()) {
+      break;
+    }
+  }
+
+  const Record& left = records_[cursor_];
+  if (time <= left.time || cursor_ + 1 == records_.size()) {
+    h  = RealType(left.h);
+    hu = RealType(left.hu);
+    return;
+  }
+
+  const Record& right  = records_[cursor_ + 1];
+  const double  weight = (time - left.time) / (right.time - left.time);
+  h                    = RealType(left.h + weight * (right.h - left.h));
+  hu                   = RealType(left.hu + weight * (right.hu - left.hu));
+}
+
+bool Tools::ForcingTable::hasMomentum() const { return hasMomentum_; }
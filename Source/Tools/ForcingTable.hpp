@@ -0,0 +1,117 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#pragma once
+
+#include <fstream>
+#include <future>
+#include <string>
+#include <vector>
+
+#include "SWE1DExport.hpp"
+#include "Tools/RealType.hpp"
+
+namespace Tools {
+
+  /**
+   * A time series of water height and momentum (e.g. a tide or a hydrograph)
+   * that is streamed from a file
+   *
+   * Files ending with ".csv" contain one record "time,h[,hu]" per line
+   * (commas or whitespace), all other files contain binary records of three
+   * doubles (time, h, hu). Times must be increasing.
+   *
+   * Only a block of records is kept in memory, the next block is read
+   * asynchronously while the current one is used. Evaluation times must be
+   * non-decreasing, which allows to find the interval with a monotone cursor
+   * in amortized O(1) instead of a search.
+   */
+  class SWE1D_EXPORT ForcingTable {
+  private:
+    struct Record {
+      double time;
+      double h;
+      double hu;
+    };
+
+    /** Number of records read at once */
+    static constexpr std::size_t BlockSize = 1 << 16;
+
+    std::ifstream file_;
+
+    bool binary_;
+    /** False if the file only contains water heights */
+    bool hasMomentum_;
+
+    /** Records in memory, starting with the last record of the previous block */
+    std::vector<Record> records_;
+    /** records_[cursor_] is the last record with time <= the last evaluation time */
+    std::size_t cursor_;
+
+    /** The block that is read in the background */
+    std::future<std::vector<Record>> nextBlock_;
+
+    /**
+     * @param hasMomentum Set to false if a record without momentum is found
+     *  (only used for the first block, which is not read asynchronously)
+     */
+    std::vector<Record> readBlock(bool* hasMomentum);
+
+    /**
+     * Replaces the current block with the prefetched one
+     *
+     * @return False at the end of the file
+     */
+    bool advanceBlock();
+
+  public:
+    ForcingTable(const std::string& fileName);
+    ~ForcingTable();
+
+    ForcingTable(const ForcingTable&)            = delete;
+    ForcingTable& operator=(const ForcingTable&) = delete;
+
+    /**
+     * Interpolates the forcing linearly at time (constant before the first and
+     * after the last record)
+     *
+     * @param time Must not be smaller than in the previous call
+     */
+    void evaluate(double time, RealType& h, RealType& hu);
+
+    bool hasMomentum() const;
+  };
+
+} // namespace Tools
@@ -0,0 +1,61 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#include "Grid.hpp"
+
+std::vector<RealType> Tools::Grid::getCellFaces(const RealType* cellSizes, IndexType size) {
+  // Summed in double precision, so the last face stays at the length of the domain
+  std::vector<RealType> faces(size + 1);
+  faces[0] = RealType(0.0);
+
+  double position = 0.0;
+  for (IndexType i = 0; i < size; i++) {
+    position += cellSizes[i];
+    faces[i + 1] = RealType(position);
+  }
+
+  return faces;
+}
+
+std::vector<RealType> Tools::Grid::getCellCenters(const RealType* cellSizes, IndexType size) {
+  std::vector<RealType> centers(size);
+  double                position = 0.0;
+  for (IndexType i = 0; i < size; i++) {
+    centers[i] = RealType(position + 0.5 * cellSizes[i]);
+    position += cellSizes[i];
+  }
+
+  return centers;
+}
@@ -0,0 +1,106 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#include "HealthCheck.hpp"
+
+#include <algorithm>
+
+#include "Logger.hpp"
+
+namespace {
+  /** Number of cells scanned branch-free before testing for a bad value */
+  constexpr IndexType ScanBlockSize = 1024;
+} // namespace
+
+Tools::HealthCheck::HealthCheck(unsigned int interval):
+  interval_(interval) {}
+
+Tools::HealthCheck::Report Tools::HealthCheck::scan(const RealType* h, const RealType* hu, IndexType size) {
+  Report report = {true, 0, RealType(0.0), RealType(0.0)};
+
+  for (IndexType begin = 1; begin < size + 1; begin += ScanBlockSize) {
+    const IndexType end = std::min(begin + ScanBlockSize, size + 1);
+
+    RealType     mass     = RealType(0.0);
+    RealType     momentum = RealType(0.0);
+    unsigned int bad      = 0;
+
+    // x - x is NaN (and thus not equal to 0) for NaN and Inf, h >= 0 is false for NaN
+#pragma omp simd reduction(+ : mass, momentum, bad)
+    for (IndexType i = begin; i < end; i++) {
+      mass += h[i];
+      momentum += hu[i];
+      bad += !(h[i] >= RealType(0.0)) | !(h[i] - h[i] == RealType(0.0)) | !(hu[i] - hu[i] == RealType(0.0));
+    }
+
+    report.mass += mass;
+    report.momentum += momentum;
+
+    if (bad > 0) {
+      // Only the block containing the error is scanned a second time
+      for (IndexType i = begin; i < end; i++) {
+        if (!(h[i] >= RealType(0.0)) || !(h[i] - h[i] == RealType(0.0)) || !(hu[i] - hu[i] == RealType(0.0))) {
+          report.healthy      = false;
+          report.firstBadCell = i;
+          return report;
+        }
+      }
+    }
+  }
+
+  return report;
+}
+
+bool Tools::HealthCheck::check(unsigned int step, double time, const RealType* h, const RealType* hu, IndexType size) {
+  if (!isDue(step)) {
+    return false;
+  }
+
+  const Report report = scan(h, hu, size);
+
+  if (!report.healthy) {
+    const IndexType i = report.firstBadCell;
+    Logger::logger
+      << "Health check failed in iteration " << step << " at time " << time << ": cell " << i << " has h = " << h[i] << ", hu = " << hu[i]
+      << " (h[" << i - 1 << "] = " << h[i - 1] << ", h[" << i + 1 << "] = " << h[i + 1] << ")" << std::endl;
+    Logger::logger.error("Unphysical state detected, aborting simulation");
+  }
+
+  Logger::logger << "Health check in iteration " << step << ": mass " << report.mass << ", momentum " << report.momentum << std::endl;
+
+  return true;
+}
+
+bool Tools::HealthCheck::isDue(unsigned int step) const { return interval_ != 0 && step % interval_ == 0; }
@@ -0,0 +1,91 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#pragma once
+
+#include "SWE1DExport.hpp"
+#include "Tools/IndexType.hpp"
+#include "Tools/RealType.hpp"
+
+namespace Tools {
+
+  /**
+   * Cheap replacement for floating point traps: scans h and hu for NaN/Inf
+   * and negative water heights and accumulates the conserved totals in the
+   * same (vectorized) pass.
+   */
+  class SWE1D_EXPORT HealthCheck {
+  public:
+    struct Report {
+      /** True if all cells contain finite values and non-negative heights */
+      bool healthy;
+      /** Index of the first bad cell (only valid if !healthy) */
+      IndexType firstBadCell;
+      /** Total mass, i.e. sum of h over all inner cells */
+      RealType mass;
+      /** Total momentum, i.e. sum of hu over all inner cells */
+      RealType momentum;
+    };
+
+  private:
+    /** Number of time steps between two checks, 0 disables the check */
+    unsigned int interval_;
+
+  public:
+    HealthCheck(unsigned int interval);
+    ~HealthCheck() = default;
+
+    /**
+     * Scans all inner cells [1,..,size]
+     *
+     * @param size Number of cells (without boundary values)
+     */
+    static Report scan(const RealType* h, const RealType* hu, IndexType size);
+
+    /**
+     * Runs a scan if step is a multiple of the interval. Reports the first
+     * bad cell, the step and the time and aborts if the state is unhealthy.
+     *
+     * @return True if a scan has been performed
+     */
+    bool check(unsigned int step, double time, const RealType* h, const RealType* hu, IndexType size);
+
+    /**
+     * @return True if check() scans the state in this step
+     */
+    bool isDue(unsigned int step) const;
+  };
+
+} // namespace Tools
@@ -39,9 +39,11 @@
 #include <cstdlib>
 #include <iostream>
 
+#include "SWE1DExport.hpp"
+
 namespace Tools {
 
-  class Logger {
+  class SWE1D_EXPORT Logger {
   public:
     enum Level { INFO, WARNING, ERROR };
 
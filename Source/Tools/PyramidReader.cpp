@@ -0,0 +1,133 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#include "PyramidReader.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "Tools/Logger.hpp"
+
+Tools::PyramidReader::PyramidReader(const std::string& fileName):
+  file_(fileName.c_str(), std::ios::in | std::ios::binary),
+  size_(0),
+  numLevels_(0),
+  fullResolution_(false),
+  cellSize_(0),
+  frameBytes_(0),
+  numFrames_(0) {
+
+  char          magic[4];
+  std::uint32_t header[3];
+  std::uint64_t size;
+  double        cellSize;
+  file_.read(magic, 4);
+  file_.read(reinterpret_cast<char*>(header), sizeof(header));
+  file_.read(reinterpret_cast<char*>(&size), sizeof(size));
+  file_.read(reinterpret_cast<char*>(&cellSize), sizeof(cellSize));
+
+  if (!file_.good() || std::memcmp(magic, "SWEL", 4) != 0) {
+    Logger::logger.error(("Could not read pyramid file " + fileName).c_str());
+  }
+  if (header[0] != sizeof(RealType)) {
+    Logger::logger.error("Pyramid file uses a different floating point precision");
+  }
+
+  size_           = static_cast<IndexType>(size);
+  numLevels_      = header[1];
+  fullResolution_ = header[2] != 0;
+  cellSize_       = static_cast<RealType>(cellSize);
+  frameBytes_     = Writers::PyramidWriter::getFrameBytes(size_, fullResolution_);
+
+  file_.seekg(0, std::ios::end);
+  numFrames_ = static_cast<unsigned int>((static_cast<std::uint64_t>(file_.tellg()) - Writers::PyramidWriter::HeaderBytes) / frameBytes_);
+}
+
+unsigned int Tools::PyramidReader::getNumFrames() const { return numFrames_; }
+
+unsigned int Tools::PyramidReader::getNumLevels() const { return numLevels_; }
+
+bool Tools::PyramidReader::hasFullResolution() const { return fullResolution_; }
+
+IndexType Tools::PyramidReader::getLevelSize(unsigned int level) const { return Writers::PyramidWriter::getLevelSize(size_, level); }
+
+RealType Tools::PyramidReader::getCellSize(unsigned int level) const { return cellSize_ * static_cast<RealType>(std::uint64_t(1) << level); }
+
+void Tools::PyramidReader::seek(unsigned int frame, std::uint64_t offset) {
+  if (frame >= numFrames_) {
+    Logger::logger.error("Frame not in pyramid file");
+  }
+
+  file_.clear();
+  file_.seekg(static_cast<std::streamoff>(Writers::PyramidWriter::HeaderBytes + frame * frameBytes_ + offset));
+}
+
+double Tools::PyramidReader::readTime(unsigned int frame) {
+  double time;
+  seek(frame, 0);
+  file_.read(reinterpret_cast<char*>(&time), sizeof(time));
+
+  return time;
+}
+
+void Tools::PyramidReader::readLevel(unsigned int frame, unsigned int level, IndexType begin, IndexType end, std::vector<Writers::PyramidWriter::Record>& records) {
+  if (level >= numLevels_ || (level == 0 && !fullResolution_)) {
+    Logger::logger.error("Level not in pyramid file");
+  }
+  end   = std::min(end, getLevelSize(level));
+  begin = std::min(begin, end);
+  records.resize(end - begin);
+
+  const std::uint64_t levelOffset = Writers::PyramidWriter::getLevelOffset(size_, level);
+
+  if (level > 0) {
+    seek(frame, levelOffset + begin * sizeof(Writers::PyramidWriter::Record));
+    file_.read(reinterpret_cast<char*>(records.data()), records.size() * sizeof(Writers::PyramidWriter::Record));
+  } else {
+    std::vector<RealType> values(2 * records.size());
+    seek(frame, levelOffset + 2 * std::uint64_t(begin) * sizeof(RealType));
+    file_.read(reinterpret_cast<char*>(values.data()), values.size() * sizeof(RealType));
+
+    for (std::size_t i = 0; i < records.size(); i++) {
+      const RealType h  = values[2 * i];
+      const RealType hu = values[2 * i + 1];
+      records[i]        = {h, h, h, hu, hu, hu};
+    }
+  }
+
+  if (!file_.good()) {
+    Logger::logger.error("Could not read pyramid level");
+  }
+}
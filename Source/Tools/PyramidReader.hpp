@@ -0,0 +1,95 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "SWE1DExport.hpp"
+#include "Tools/IndexType.hpp"
+#include "Tools/RealType.hpp"
+#include "Writers/PyramidWriter.hpp"
+
+namespace Tools {
+
+  /**
+   * Random access to the levels of files written by Writers::PyramidWriter
+   */
+  class SWE1D_EXPORT PyramidReader {
+  private:
+    std::ifstream file_;
+
+    IndexType    size_;
+    unsigned int numLevels_;
+    bool         fullResolution_;
+    RealType     cellSize_;
+
+    std::uint64_t frameBytes_;
+    unsigned int  numFrames_;
+
+    void seek(unsigned int frame, std::uint64_t offset);
+
+  public:
+    PyramidReader(const std::string& fileName);
+    ~PyramidReader() = default;
+
+    unsigned int getNumFrames() const;
+    unsigned int getNumLevels() const;
+    bool         hasFullResolution() const;
+
+    /**
+     * @return Number of points of a level
+     */
+    IndexType getLevelSize(unsigned int level) const;
+
+    /**
+     * @return Distance of two points of a level
+     */
+    RealType getCellSize(unsigned int level) const;
+
+    double readTime(unsigned int frame);
+
+    /**
+     * Reads the points [begin,..,end-1] of a level, only this range is read
+     * from the file. For level 0, minimum, maximum and mean are the values
+     * of the cell.
+     */
+    void readLevel(unsigned int frame, unsigned int level, IndexType begin, IndexType end, std::vector<Writers::PyramidWriter::Record>& records);
+  };
+
+} // namespace Tools
@@ -0,0 +1,126 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#include "SharedMemoryReader.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "Tools/Logger.hpp"
+
+Tools::SharedMemoryReader::SharedMemoryReader(const std::string& name):
+  memory_(nullptr),
+  memorySize_(0),
+  header_(nullptr) {
+
+  const std::string fullName = name.empty() || name[0] != '/' ? "/" + name : name;
+
+  const int fd = shm_open(fullName.c_str(), O_RDONLY, 0);
+  if (fd < 0) {
+    Logger::logger.error(("Could not open shared memory " + fullName).c_str());
+  }
+
+  struct stat status;
+  if (fstat(fd, &status) != 0 || static_cast<std::size_t>(status.st_size) < sizeof(Writers::SharedMemoryWriter::Header)) {
+    close(fd);
+    Logger::logger.error(("Invalid shared memory " + fullName).c_str());
+  }
+
+  memorySize_ = static_cast<std::size_t>(status.st_size);
+  memory_     = mmap(nullptr, memorySize_, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (memory_ == MAP_FAILED) {
+    Logger::logger.error(("Could not map shared memory " + fullName).c_str());
+  }
+
+  header_ = static_cast<const Writers::SharedMemoryWriter::Header*>(memory_);
+  if (std::memcmp(header_->magic, "SWEM", 4) != 0) {
+    Logger::logger.error(("Shared memory " + fullName + " is not written by SWE1D").c_str());
+  }
+  std::atomic_thread_fence(std::memory_order_acquire);
+
+  if (header_->realSize != sizeof(RealType)) {
+    Logger::logger.error("Shared memory uses a different floating point precision");
+  }
+}
+
+Tools::SharedMemoryReader::~SharedMemoryReader() { munmap(const_cast<void*>(memory_), memorySize_); }
+
+std::uint64_t Tools::SharedMemoryReader::getNumFrames() const { return header_->latest.load(std::memory_order_acquire); }
+
+RealType Tools::SharedMemoryReader::getCellSize() const { return static_cast<RealType>(header_->cellSize); }
+
+bool Tools::SharedMemoryReader::readLatest(Frame& frame) const {
+  const unsigned int numPoints = header_->numPoints;
+  frame.h.resize(numPoints);
+  frame.hu.resize(numPoints);
+
+  while (true) {
+    const std::uint64_t latest = header_->latest.load(std::memory_order_acquire);
+    if (latest == 0) {
+      return false;
+    }
+
+    const char* slotMemory = static_cast<const char*>(memory_) + Writers::SharedMemoryWriter::getSlotOffset()
+                             + (latest - 1) % header_->numSlots * Writers::SharedMemoryWriter::getSlotSize(numPoints);
+    const Writers::SharedMemoryWriter::Slot* slot = reinterpret_cast<const Writers::SharedMemoryWriter::Slot*>(slotMemory);
+
+    const std::uint64_t before = slot->sequence.load(std::memory_order_acquire);
+    if (before % 2 != 0) {
+      // The writer is just overwriting this slot
+      continue;
+    }
+
+    frame.number    = slot->frame;
+    frame.time      = slot->time;
+    frame.mass      = slot->mass;
+    frame.momentum  = slot->momentum;
+    frame.maxHeight = slot->maxHeight;
+    frame.maxSpeed  = slot->maxSpeed;
+
+    const RealType* points = reinterpret_cast<const RealType*>(slotMemory + sizeof(Writers::SharedMemoryWriter::Slot));
+    std::copy(points, points + numPoints, frame.h.begin());
+    std::copy(points + numPoints, points + 2 * numPoints, frame.hu.begin());
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (slot->sequence.load(std::memory_order_relaxed) == before) {
+      return true;
+    }
+  }
+}
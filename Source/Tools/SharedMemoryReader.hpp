@@ -0,0 +1,102 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "SWE1DExport.hpp"
+#include "Tools/RealType.hpp"
+#include "Writers/SharedMemoryWriter.hpp"
+
+namespace Tools {
+
+  /**
+   * Reads the latest frame published by Writers::SharedMemoryWriter without
+   * blocking the writer
+   */
+  class SWE1D_EXPORT SharedMemoryReader {
+  public:
+    struct Frame {
+      /** Number of the frame (counting from 0) */
+      std::uint64_t number;
+      double        time;
+      double        mass;
+      double        momentum;
+      double        maxHeight;
+      double        maxSpeed;
+      /** Downsampled water height and momentum */
+      std::vector<RealType> h;
+      std::vector<RealType> hu;
+    };
+
+  private:
+    const void* memory_;
+    std::size_t memorySize_;
+
+    const Writers::SharedMemoryWriter::Header* header_;
+
+  public:
+    /**
+     * @param name Name of the shared memory object (a leading '/' is added if missing)
+     */
+    SharedMemoryReader(const std::string& name);
+    ~SharedMemoryReader();
+
+    SharedMemoryReader(const SharedMemoryReader&)            = delete;
+    SharedMemoryReader& operator=(const SharedMemoryReader&) = delete;
+
+    /**
+     * @return Number of frames published so far
+     */
+    std::uint64_t getNumFrames() const;
+
+    /**
+     * @return Distance of two points of a frame
+     */
+    RealType getCellSize() const;
+
+    /**
+     * Copies the latest frame, retries if the writer modified it meanwhile
+     *
+     * @return False if no frame has been published yet
+     */
+    bool readLatest(Frame& frame) const;
+  };
+
+} // namespace Tools
@@ -0,0 +1,185 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#include "TaskGraph.hpp"
+
+#include <algorithm>
+
+Tools::TaskGraph::TaskGraph(unsigned int numThreads):
+  numThreads_(std::max(numThreads, 1u)),
+  queues_(numThreads_),
+  generation_(0),
+  finished_(false),
+  remaining_(0),
+  activeWorkers_(0) {
+
+  for (unsigned int i = 1; i < numThreads_; i++) {
+    workers_.emplace_back(&TaskGraph::work, this, i);
+  }
+}
+
+Tools::TaskGraph::~TaskGraph() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    finished_ = true;
+  }
+  condition_.notify_all();
+
+  for (std::thread& worker : workers_) {
+    worker.join();
+  }
+}
+
+Tools::TaskGraph::TaskId Tools::TaskGraph::addTask(std::function<void()> function, const std::vector<TaskId>& predecessors) {
+  const TaskId id = static_cast<TaskId>(tasks_.size());
+  tasks_.emplace_back(std::move(function));
+
+  for (const TaskId predecessor : predecessors) {
+    addDependency(predecessor, id);
+  }
+
+  return id;
+}
+
+void Tools::TaskGraph::addDependency(TaskId predecessor, TaskId successor) {
+  tasks_[predecessor].successors.push_back(successor);
+  tasks_[successor].numPredecessors++;
+}
+
+void Tools::TaskGraph::run() {
+  if (tasks_.empty()) {
+    return;
+  }
+
+  // Distribute the initially ready tasks round robin
+  unsigned int worker = 0;
+  for (TaskId id = 0; id < tasks_.size(); id++) {
+    tasks_[id].pending.store(tasks_[id].numPredecessors, std::memory_order_relaxed);
+    if (tasks_[id].numPredecessors == 0) {
+      push(worker, id);
+      worker = (worker + 1) % numThreads_;
+    }
+  }
+
+  remaining_.store(static_cast<unsigned int>(tasks_.size()));
+  activeWorkers_.store(numThreads_ - 1);
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    generation_++;
+  }
+  condition_.notify_all();
+
+  execute(0);
+
+  // All workers must leave execute() before the tasks can be modified again
+  while (activeWorkers_.load() > 0) {
+    std::this_thread::yield();
+  }
+}
+
+void Tools::TaskGraph::clear() { tasks_.clear(); }
+
+unsigned int Tools::TaskGraph::getNumThreads() const { return numThreads_; }
+
+void Tools::TaskGraph::work(unsigned int worker) {
+  unsigned int generation = 0;
+
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      condition_.wait(lock, [this, generation] { return finished_ || generation_ != generation; });
+      if (finished_) {
+        return;
+      }
+      generation = generation_;
+    }
+
+    execute(worker);
+    activeWorkers_--;
+  }
+}
+
+void Tools::TaskGraph::execute(unsigned int worker) {
+  while (remaining_.load(std::memory_order_acquire) > 0) {
+    TaskId id;
+    if (!pop(worker, id) && !steal(worker, id)) {
+      std::this_thread::yield();
+      continue;
+    }
+
+    Task& task = tasks_[id];
+    task.function();
+
+    for (const TaskId successor : task.successors) {
+      if (tasks_[successor].pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        push(worker, successor);
+      }
+    }
+
+    remaining_.fetch_sub(1, std::memory_order_release);
+  }
+}
+
+void Tools::TaskGraph::push(unsigned int worker, TaskId task) {
+  std::lock_guard<std::mutex> lock(queues_[worker].mutex);
+  queues_[worker].tasks.push_back(task);
+}
+
+bool Tools::TaskGraph::pop(unsigned int worker, TaskId& task) {
+  std::lock_guard<std::mutex> lock(queues_[worker].mutex);
+  if (queues_[worker].tasks.empty()) {
+    return false;
+  }
+
+  task = queues_[worker].tasks.back();
+  queues_[worker].tasks.pop_back();
+  return true;
+}
+
+bool Tools::TaskGraph::steal(unsigned int worker, TaskId& task) {
+  for (unsigned int i = 1; i < numThreads_; i++) {
+    WorkQueue& victim = queues_[(worker + i) % numThreads_];
+
+    std::lock_guard<std::mutex> lock(victim.mutex);
+    if (!victim.tasks.empty()) {
+      task = victim.tasks.front();
+      victim.tasks.pop_front();
+      return true;
+    }
+  }
+
+  return false;
+}
@@ -0,0 +1,145 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "SWE1DExport.hpp"
+
+namespace Tools {
+
+  /**
+   * Executes a graph of tasks with dependencies on a persistent pool of threads
+   *
+   * A task becomes ready as soon as all its predecessors are finished. Ready
+   * tasks are pushed to the queue of the thread that finished the last
+   * predecessor (LIFO for the owner, which keeps data in the cache), idle
+   * threads steal the oldest tasks from other queues.
+   */
+  class SWE1D_EXPORT TaskGraph {
+  public:
+    using TaskId = unsigned int;
+
+  private:
+    struct Task {
+      std::function<void()> function;
+      std::vector<TaskId>   successors;
+      unsigned int          numPredecessors;
+      /** Number of unfinished predecessors during run() */
+      std::atomic<unsigned int> pending;
+
+      Task(std::function<void()>&& f):
+        function(std::move(f)),
+        numPredecessors(0),
+        pending(0) {}
+    };
+
+    struct WorkQueue {
+      std::mutex         mutex;
+      std::deque<TaskId> tasks;
+    };
+
+    /** Deque keeps the tasks (and their atomics) at fixed addresses */
+    std::deque<Task> tasks_;
+
+    unsigned int             numThreads_;
+    std::vector<WorkQueue>   queues_;
+    std::vector<std::thread> workers_;
+
+    std::mutex              mutex_;
+    std::condition_variable condition_;
+    /** Incremented for each run, wakes up the workers */
+    unsigned int generation_;
+    bool         finished_;
+
+    /** Tasks not yet finished in the current run */
+    std::atomic<unsigned int> remaining_;
+    /** Workers still executing the current run */
+    std::atomic<unsigned int> activeWorkers_;
+
+    void work(unsigned int worker);
+
+    /**
+     * Executes tasks until all tasks of the current run are finished
+     */
+    void execute(unsigned int worker);
+
+    void push(unsigned int worker, TaskId task);
+    bool pop(unsigned int worker, TaskId& task);
+    bool steal(unsigned int worker, TaskId& task);
+
+  public:
+    /**
+     * @param numThreads Number of threads (including the thread calling run())
+     */
+    TaskGraph(unsigned int numThreads = std::thread::hardware_concurrency());
+    ~TaskGraph();
+
+    TaskGraph(const TaskGraph&)            = delete;
+    TaskGraph& operator=(const TaskGraph&) = delete;
+
+    /**
+     * Adds a task that runs after all predecessors are finished
+     *
+     * @param predecessors Tasks that have already been added
+     */
+    TaskId addTask(std::function<void()> function, const std::vector<TaskId>& predecessors = {});
+
+    /**
+     * Adds an additional dependency between two existing tasks
+     */
+    void addDependency(TaskId predecessor, TaskId successor);
+
+    /**
+     * Executes all tasks and waits until they are finished
+     */
+    void run();
+
+    /**
+     * Removes all tasks
+     */
+    void clear();
+
+    unsigned int getNumThreads() const;
+  };
+
+} // namespace Tools
@@ -0,0 +1,157 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#include "CompressedWriter.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+#include "Tools/Logger.hpp"
+
+Writers::CompressedWriter::CompressedWriter(const std::string& fileName, const RealType cellSize, Tools::Compression::Mode mode, double tolerance):
+  file_(fileName.c_str(), std::ios::out | std::ios::binary),
+  mode_(mode),
+  tolerance_(tolerance),
+  finished_(false),
+  numFrames_(0),
+  rawBytes_(0),
+  compressedBytes_(0),
+  compressionTime_(0) {
+
+  if (!file_.good()) {
+    Tools::Logger::logger.error(("Could not open output file " + fileName).c_str());
+  }
+
+  const std::uint32_t realSize       = sizeof(RealType);
+  const double        doubleCellSize = cellSize;
+  file_.write("SWEC", 4);
+  file_.write(reinterpret_cast<const char*>(&realSize), sizeof(realSize));
+  file_.write(reinterpret_cast<const char*>(&doubleCellSize), sizeof(doubleCellSize));
+
+  thread_ = std::thread(&CompressedWriter::run, this);
+}
+
+Writers::CompressedWriter::~CompressedWriter() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    finished_ = true;
+  }
+  condition_.notify_all();
+  thread_.join();
+
+  if (numFrames_ > 0) {
+    Tools::Logger::logger
+      << "Compressed output: " << numFrames_ << " frames, " << rawBytes_ << " -> " << compressedBytes_ << " bytes (ratio "
+      << double(rawBytes_) / double(std::max<std::uint64_t>(compressedBytes_, 1)) << "), " << double(rawBytes_) / 1e6 / std::max(compressionTime_, 1e-9)
+      << " MB/s" << std::endl;
+  }
+}
+
+void Writers::CompressedWriter::write(const RealType time, const RealType* h, const RealType* hu, IndexType size) {
+  std::unique_lock<std::mutex> lock(mutex_);
+
+  // Limit the memory used by pending frames
+  condition_.wait(lock, [this] { return queue_.size() < 2; });
+
+  Frame frame;
+  if (!freeFrames_.empty()) {
+    frame = std::move(freeFrames_.back());
+    freeFrames_.pop_back();
+  }
+  lock.unlock();
+
+  // Copy outside of the lock, so the I/O thread is not blocked
+  frame.time = time;
+  frame.h.assign(h + 1, h + size + 1);
+  frame.hu.assign(hu + 1, hu + size + 1);
+
+  lock.lock();
+  queue_.push_back(std::move(frame));
+  lock.unlock();
+  condition_.notify_all();
+}
+
+void Writers::CompressedWriter::run() {
+  while (true) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    condition_.wait(lock, [this] { return finished_ || !queue_.empty(); });
+    if (queue_.empty()) {
+      // Finished and all frames are written
+      break;
+    }
+
+    Frame frame = std::move(queue_.front());
+    queue_.pop_front();
+    lock.unlock();
+    condition_.notify_all();
+
+    const std::uint64_t size = frame.h.size();
+    file_.write(reinterpret_cast<const char*>(&frame.time), sizeof(frame.time));
+    file_.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    file_.write(reinterpret_cast<const char*>(&tolerance_), sizeof(tolerance_));
+    writeField(frame.h);
+    writeField(frame.hu);
+    numFrames_++;
+
+    lock.lock();
+    freeFrames_.push_back(std::move(frame));
+  }
+
+  file_.flush();
+}
+
+void Writers::CompressedWriter::writeField(const std::vector<RealType>& values) {
+  const std::uint64_t numChunks = (values.size() + ChunkSize - 1) / ChunkSize;
+  file_.write(reinterpret_cast<const char*>(&numChunks), sizeof(numChunks));
+
+  for (std::size_t begin = 0; begin < values.size(); begin += ChunkSize) {
+    const std::uint64_t numValues = std::min(ChunkSize, values.size() - begin);
+
+    const auto                      start = std::chrono::steady_clock::now();
+    Tools::Compression::Mode        usedMode;
+    const std::vector<std::uint8_t> data = Tools::Compression::compress(&values[begin], numValues, mode_, tolerance_, usedMode);
+    compressionTime_ += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    const std::uint8_t  mode     = usedMode;
+    const std::uint64_t numBytes = data.size();
+    file_.write(reinterpret_cast<const char*>(&mode), sizeof(mode));
+    file_.write(reinterpret_cast<const char*>(&numValues), sizeof(numValues));
+    file_.write(reinterpret_cast<const char*>(&numBytes), sizeof(numBytes));
+    file_.write(reinterpret_cast<const char*>(data.data()), numBytes);
+
+    rawBytes_ += numValues * sizeof(RealType);
+    compressedBytes_ += numBytes;
+  }
+}
@@ -0,0 +1,126 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Tools/Compression.hpp"
+#include "SWE1DExport.hpp"
+#include "Tools/IndexType.hpp"
+#include "Tools/RealType.hpp"
+#include "Writers/Writer.hpp"
+
+namespace Writers {
+
+  /**
+   * A writer class that stores all time steps compressed in one file
+   *
+   * The values are copied into a frame buffer by write(); compression and
+   * file output happen on a separate I/O thread. At most two frames are
+   * queued, if the I/O thread falls behind, write() blocks.
+   *
+   * File layout (native endianness):
+   * <pre>
+   *   header:  "SWEC" | uint32 sizeof(RealType) | double cellSize
+   *   frame:   double time | uint64 size | double tolerance |
+   *            for h and hu: uint64 numChunks |
+   *              for each chunk: uint8 mode | uint64 numValues | uint64 numBytes | data
+   * </pre>
+   *
+   * Tools::CompressedReader decodes these files.
+   */
+  class SWE1D_EXPORT CompressedWriter: public Writer {
+  public:
+    /** Number of values compressed independently */
+    static constexpr std::size_t ChunkSize = std::size_t(1) << 20;
+
+  private:
+    struct Frame {
+      double                time;
+      std::vector<RealType> h;
+      std::vector<RealType> hu;
+    };
+
+    std::ofstream file_;
+
+    Tools::Compression::Mode mode_;
+    double                   tolerance_;
+
+    std::thread             thread_;
+    std::mutex              mutex_;
+    std::condition_variable condition_;
+
+    /** Frames waiting for the I/O thread */
+    std::deque<Frame> queue_;
+    /** Frame buffers that can be reused */
+    std::vector<Frame> freeFrames_;
+    bool               finished_;
+
+    // Statistics (only modified by the I/O thread)
+    unsigned int  numFrames_;
+    std::uint64_t rawBytes_;
+    std::uint64_t compressedBytes_;
+    double        compressionTime_;
+
+    void run();
+    void writeField(const std::vector<RealType>& values);
+
+  public:
+    /**
+     * @param tolerance Absolute error bound of the LOSSY mode
+     */
+    CompressedWriter(const std::string& fileName, const RealType cellSize, Tools::Compression::Mode mode, double tolerance = 1e-3);
+    /**
+     * Waits for all pending frames and reports the compression ratio and throughput
+     */
+    ~CompressedWriter() override;
+
+    /**
+     * Queues all values (without boundary values) for compression
+     *
+     * @param size Number of cells (without boundary values)
+     */
+    void write(const RealType time, const RealType* h, const RealType* hu, IndexType size) override;
+  };
+
+} // namespace Writers
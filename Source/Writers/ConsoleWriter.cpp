@@ -39,13 +39,15 @@
 Writers::ConsoleWriter::ConsoleWriter(std::ostream& ostream):
   ostream_(ostream) {}
 
-void Writers::ConsoleWriter::write(const RealType* h, const RealType* hu, unsigned int size) {
-  for (unsigned int i = 1; i < size + 1; i++) {
+void Writers::ConsoleWriter::write(const RealType* h, const RealType* hu, IndexType size) {
+  for (IndexType i = 1; i < size + 1; i++) {
     ostream_ << h[i] << ' ';
   }
   ostream_ << '\n'; // Do not flush the buffer here (do not use std::endl)
-  for (unsigned int i = 1; i < size + 1; i++) {
+  for (IndexType i = 1; i < size + 1; i++) {
     ostream_ << hu[i] << ' ';
   }
   ostream_ << std::endl;
 }
+
+void Writers::ConsoleWriter::write([[maybe_unused]] const RealType time, const RealType* h, const RealType* hu, IndexType size) { write(h, hu, size); }
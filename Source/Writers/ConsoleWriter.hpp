@@ -38,27 +38,35 @@
 
 #include <iostream>
 
+#include "SWE1DExport.hpp"
+#include "Tools/IndexType.hpp"
 #include "Tools/RealType.hpp"
+#include "Writers/Writer.hpp"
 
 namespace Writers {
 
   /**
    * A simple writer class, that writes h and hu to stdout (or another ostream)
    */
-  class ConsoleWriter {
+  class SWE1D_EXPORT ConsoleWriter: public Writer {
   private:
     std::ostream& ostream_;
 
   public:
     ConsoleWriter(std::ostream& ostream = std::cout);
-    ~ConsoleWriter() = default;
+    ~ConsoleWriter() override = default;
 
     /**
      * Writes all values (without boundary values) to the ostream
      *
      * @param size Number of cells (without boundary values)
      */
-    void write(const RealType* h, const RealType* hu, unsigned int size);
+    void write(const RealType* h, const RealType* hu, IndexType size);
+
+    /**
+     * Same as write(h, hu, size), the time is not printed
+     */
+    void write(const RealType time, const RealType* h, const RealType* hu, IndexType size) override;
   };
 
 } // namespace Writers
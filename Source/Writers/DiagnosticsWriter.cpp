@@ -0,0 +1,86 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#include "DiagnosticsWriter.hpp"
+
+#include <limits>
+
+#include "Tools/Grid.hpp"
+#include "Tools/Logger.hpp"
+
+Writers::DiagnosticsWriter::DiagnosticsWriter(const std::string& fileName, const RealType cellSize):
+  binary_(!fileName.ends_with(".csv")),
+  cellSize_(cellSize) {
+
+  file_.open(fileName.c_str(), binary_ ? std::ios::out | std::ios::binary : std::ios::out);
+  if (!file_.good()) {
+    Tools::Logger::logger.error(("Could not open diagnostics file " + fileName).c_str());
+  }
+
+  if (!binary_) {
+    file_.precision(std::numeric_limits<double>::max_digits10);
+    file_ << "step,time,mass,momentum,maxHeight,maxSpeed,frontPosition" << std::endl;
+  }
+}
+
+void Writers::DiagnosticsWriter::write(unsigned int step, double time, const Blocks::Diagnostics& diagnostics) {
+  if (binary_) {
+    const double record[] = {
+      double(step),
+      time,
+      double(diagnostics.mass),
+      double(diagnostics.momentum),
+      double(diagnostics.maxHeight),
+      double(diagnostics.maxSpeed),
+      double(getFrontPosition(diagnostics))};
+    file_.write(reinterpret_cast<const char*>(record), sizeof(record));
+  } else {
+    file_
+      << step << ',' << time << ',' << diagnostics.mass << ',' << diagnostics.momentum << ',' << diagnostics.maxHeight << ',' << diagnostics.maxSpeed << ','
+      << getFrontPosition(diagnostics) << '\n'; // Do not flush the buffer here
+  }
+}
+
+void Writers::DiagnosticsWriter::setCellSizes(const RealType* cellSizes, IndexType size) {
+  if (cellSizes == nullptr) {
+    cellCenters_.clear();
+  } else {
+    cellCenters_ = Tools::Grid::getCellCenters(cellSizes, size);
+  }
+}
+
+RealType Writers::DiagnosticsWriter::getFrontPosition(const Blocks::Diagnostics& diagnostics) const {
+  return cellCenters_.empty() ? diagnostics.getFrontPosition(cellSize_) : diagnostics.getFrontPosition(cellCenters_);
+}
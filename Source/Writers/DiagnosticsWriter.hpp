@@ -0,0 +1,84 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#pragma once
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "Blocks/Diagnostics.hpp"
+#include "SWE1DExport.hpp"
+#include "Tools/IndexType.hpp"
+#include "Tools/RealType.hpp"
+
+namespace Writers {
+
+  /**
+   * Writes one record of scalar diagnostics per time step.
+   *
+   * Files ending with ".csv" get one comma separated line per step, all other
+   * files get fixed-size binary records of 7 doubles
+   * (step, time, mass, momentum, maxHeight, maxSpeed, frontPosition).
+   */
+  class SWE1D_EXPORT DiagnosticsWriter {
+  private:
+    std::ofstream file_;
+
+    bool binary_;
+
+    RealType cellSize_;
+
+    /** Cell centers of a non-uniform grid (empty = uniform) */
+    std::vector<RealType> cellCenters_;
+
+    RealType getFrontPosition(const Blocks::Diagnostics& diagnostics) const;
+
+  public:
+    DiagnosticsWriter(const std::string& fileName, const RealType cellSize);
+    ~DiagnosticsWriter() = default;
+
+    void write(unsigned int step, double time, const Blocks::Diagnostics& diagnostics);
+
+    /**
+     * Places the front at the cell centers of a non-uniform grid
+     *
+     * @param cellSizes Widths of the cells (without boundary values), nullptr for the uniform grid
+     * @param size Number of cells
+     */
+    void setCellSizes(const RealType* cellSizes, IndexType size);
+  };
+
+} // namespace Writers
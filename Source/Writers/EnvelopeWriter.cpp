@@ -0,0 +1,107 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#include "EnvelopeWriter.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <vector>
+
+#include "Tools/Grid.hpp"
+#include "Tools/Logger.hpp"
+
+Writers::EnvelopeWriter::EnvelopeWriter(const std::string& fileName, const RealType cellSize):
+  fileName_(fileName),
+  binary_(!fileName.ends_with(".csv")),
+  cellSize_(cellSize) {}
+
+void Writers::EnvelopeWriter::write(double time, const Blocks::Envelope& envelope, IndexType size) {
+  // The checkpoint is written next to the file and renamed over it when complete,
+  // so an interrupted checkpoint leaves the previous one intact
+  const std::string temporaryFileName = fileName_ + ".tmp";
+
+  std::ofstream file(temporaryFileName.c_str(), binary_ ? std::ios::out | std::ios::binary : std::ios::out);
+  if (!file.good()) {
+    Tools::Logger::logger.error(("Could not open envelope file " + temporaryFileName).c_str());
+  }
+
+  assert(cellCenters_.empty() || cellCenters_.size() == size);
+
+  if (binary_) {
+    const std::uint64_t numCells = size;
+    const double        cellSize = cellCenters_.empty() ? double(cellSize_) : 0.0;
+    file.write(reinterpret_cast<const char*>(&time), sizeof(time));
+    file.write(reinterpret_cast<const char*>(&numCells), sizeof(numCells));
+    file.write(reinterpret_cast<const char*>(&cellSize), sizeof(cellSize));
+
+    std::vector<double> values(size);
+    for (const std::vector<RealType>* field : {&envelope.maxDepth, &envelope.maxSpeed, &envelope.arrivalTime}) {
+      std::copy(field->begin() + 1, field->begin() + size + 1, values.begin());
+      file.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(double));
+    }
+
+    if (!cellCenters_.empty()) {
+      std::copy(cellCenters_.begin(), cellCenters_.end(), values.begin());
+      file.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(double));
+    }
+  } else {
+    file.precision(std::numeric_limits<double>::max_digits10);
+    file << "x,maxDepth,maxSpeed,arrivalTime" << '\n';
+    for (IndexType i = 1; i < size + 1; i++) {
+      file << (cellCenters_.empty() ? (RealType(i) - RealType(0.5)) * cellSize_ : cellCenters_[i - 1]) << ',' << envelope.maxDepth[i] << ',' << envelope.maxSpeed[i] << ',' << envelope.arrivalTime[i] << '\n';
+    }
+  }
+
+  file.close();
+  if (!file.good()) {
+    Tools::Logger::logger.error(("Could not write envelope file " + temporaryFileName).c_str());
+  }
+
+  if (std::rename(temporaryFileName.c_str(), fileName_.c_str()) != 0) {
+    Tools::Logger::logger.error(("Could not replace envelope file " + fileName_).c_str());
+  }
+}
+
+void Writers::EnvelopeWriter::setCellSizes(const RealType* cellSizes, IndexType size) {
+  if (cellSizes == nullptr) {
+    cellCenters_.clear();
+  } else {
+    cellCenters_ = Tools::Grid::getCellCenters(cellSizes, size);
+  }
+}
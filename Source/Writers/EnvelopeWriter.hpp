@@ -0,0 +1,96 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Blocks/Envelope.hpp"
+#include "SWE1DExport.hpp"
+#include "Tools/IndexType.hpp"
+#include "Tools/RealType.hpp"
+
+namespace Writers {
+
+  /**
+   * Writes the per-cell envelope (maximum depth, maximum speed and arrival
+   * time) of a simulation
+   *
+   * Every call replaces the file, so it always holds the last checkpoint.
+   * The new checkpoint is written to FILE.tmp first and then renamed, so a
+   * crash during a checkpoint keeps the previous one.
+   * Files ending with ".csv" get a line "x,maxDepth,maxSpeed,arrivalTime"
+   * per cell (x is the cell center), all other files are binary (native
+   * endianness):
+   * <pre>
+   *   double time | uint64 size | double cellSize |
+   *   double maxDepth[size] | double maxSpeed[size] | double arrivalTime[size] |
+   *   if cellSize == 0: double x[size]
+   * </pre>
+   * A non-uniform grid (see setCellSizes()) has the cell size 0 and the
+   * cell centers appended.
+   */
+  class SWE1D_EXPORT EnvelopeWriter {
+  private:
+    std::string fileName_;
+
+    bool binary_;
+
+    RealType cellSize_;
+
+    /** Cell centers of a non-uniform grid (empty = uniform) */
+    std::vector<RealType> cellCenters_;
+
+  public:
+    EnvelopeWriter(const std::string& fileName, const RealType cellSize);
+    ~EnvelopeWriter() = default;
+
+    /**
+     * @param time Time of the checkpoint
+     * @param size Number of inner cells of the envelope
+     */
+    void write(double time, const Blocks::Envelope& envelope, IndexType size);
+
+    /**
+     * Writes the cell centers of a non-uniform grid instead of multiples of the cell size
+     *
+     * @param cellSizes Widths of the cells (without boundary values), nullptr for the uniform grid
+     * @param size Number of cells
+     */
+    void setCellSizes(const RealType* cellSizes, IndexType size);
+  };
+
+} // namespace Writers
@@ -0,0 +1,138 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#include "ProbeWriter.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "Tools/Logger.hpp"
+
+Writers::ProbeWriter::ProbeWriter(
+  const std::string&           fileName,
+  const std::vector<RealType>& positions,
+  const RealType               cellSize,
+  IndexType                    size,
+  bool                         interpolate,
+  unsigned int                 chunkSize
+):
+  binary_(!fileName.ends_with(".csv")),
+  chunkSize_(std::max(chunkSize, 1u)),
+  numBuffered_(0),
+  times_(chunkSize_),
+  samples_(std::size_t(chunkSize_) * positions.size() * 2) {
+
+  // Map positions to cells, cell i covers [(i-1)*cellSize, i*cellSize]
+  for (const RealType x : positions) {
+    IndexType cell   = 1;
+    RealType  weight = RealType(0.0);
+
+    if (interpolate) {
+      // Position relative to the cell centers
+      const RealType s = x / cellSize + RealType(0.5);
+      if (s >= RealType(size)) {
+        cell = size;
+      } else if (s > RealType(1.0)) {
+        cell   = static_cast<IndexType>(s);
+        weight = s - RealType(cell);
+      }
+    } else if (x > RealType(0.0)) {
+      cell = std::min(static_cast<IndexType>(x / cellSize) + 1, size);
+    }
+
+    cells_.push_back(cell);
+    weights_.push_back(weight);
+  }
+
+  file_.open(fileName.c_str(), binary_ ? std::ios::out | std::ios::binary : std::ios::out);
+  if (!file_.good()) {
+    Tools::Logger::logger.error(("Could not open probe file " + fileName).c_str());
+  }
+
+  if (!binary_) {
+    file_.precision(std::numeric_limits<RealType>::max_digits10);
+    file_ << "time";
+    for (const RealType x : positions) {
+      file_ << ",h@" << x << ",hu@" << x;
+    }
+    file_ << std::endl;
+  }
+}
+
+Writers::ProbeWriter::~ProbeWriter() { flush(); }
+
+void Writers::ProbeWriter::write(const RealType time, const RealType* h, const RealType* hu, [[maybe_unused]] IndexType size) {
+  if (numBuffered_ == chunkSize_) {
+    flush();
+  }
+
+  times_[numBuffered_] = time;
+
+  RealType* samples = &samples_[std::size_t(numBuffered_) * cells_.size() * 2];
+  for (std::size_t j = 0; j < cells_.size(); j++) {
+    const IndexType i = cells_[j];
+    const RealType  w = weights_[j];
+
+    samples[2 * j]     = (RealType(1.0) - w) * h[i] + w * h[i + 1];
+    samples[2 * j + 1] = (RealType(1.0) - w) * hu[i] + w * hu[i + 1];
+  }
+
+  numBuffered_++;
+}
+
+void Writers::ProbeWriter::flush() {
+  const std::size_t numValues = cells_.size() * 2;
+
+  if (binary_) {
+    std::vector<double> record(numValues + 1);
+    for (unsigned int n = 0; n < numBuffered_; n++) {
+      record[0] = times_[n];
+      std::copy_n(&samples_[n * numValues], numValues, &record[1]);
+      file_.write(reinterpret_cast<const char*>(record.data()), sizeof(double) * record.size());
+    }
+  } else {
+    for (unsigned int n = 0; n < numBuffered_; n++) {
+      file_ << times_[n];
+      for (std::size_t j = 0; j < numValues; j++) {
+        file_ << ',' << samples_[n * numValues + j];
+      }
+      file_ << '\n'; // Do not flush the buffer here
+    }
+  }
+
+  file_.flush();
+  numBuffered_ = 0;
+}
@@ -0,0 +1,106 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#pragma once
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "SWE1DExport.hpp"
+#include "Tools/IndexType.hpp"
+#include "Tools/RealType.hpp"
+#include "Writers/Writer.hpp"
+
+namespace Writers {
+
+  /**
+   * Samples h and hu at a few gauge positions in every time step.
+   *
+   * Samples are collected in preallocated buffers and only written to disk
+   * when a chunk is full (or when the writer is destroyed). Files ending
+   * with ".csv" get one comma separated line per step, all other files get
+   * binary records of doubles (time, h_0, hu_0, h_1, hu_1, ...).
+   */
+  class SWE1D_EXPORT ProbeWriter: public Writer {
+  private:
+    std::ofstream file_;
+
+    bool binary_;
+
+    /** Left cell used for each probe */
+    std::vector<IndexType> cells_;
+    /** Interpolation weight of the right neighbour cell for each probe */
+    std::vector<RealType> weights_;
+
+    /** Number of time steps buffered before the data is written */
+    unsigned int chunkSize_;
+    /** Number of time steps in the buffer */
+    unsigned int numBuffered_;
+
+    std::vector<double>   times_;
+    /** Samples of h and hu, interleaved per probe, one row per time step */
+    std::vector<RealType> samples_;
+
+  public:
+    /**
+     * @param positions x coordinates of the probes
+     * @param size Number of cells (without boundary values)
+     * @param interpolate Interpolate linearly between cell centers instead
+     *  of taking the value of the containing cell
+     * @param chunkSize Number of time steps buffered before writing
+     */
+    ProbeWriter(
+      const std::string&           fileName,
+      const std::vector<RealType>& positions,
+      const RealType               cellSize,
+      IndexType                    size,
+      bool                         interpolate = true,
+      unsigned int                 chunkSize   = 4096
+    );
+    ~ProbeWriter() override;
+
+    /**
+     * Records the values at all probes
+     */
+    void write(const RealType time, const RealType* h, const RealType* hu, IndexType size) override;
+
+    /**
+     * Writes all buffered time steps
+     */
+    void flush();
+  };
+
+} // namespace Writers
@@ -0,0 +1,168 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#include "PyramidWriter.hpp"
+
+#include <algorithm>
+
+#include "Tools/Logger.hpp"
+
+unsigned int Writers::PyramidWriter::getNumLevels(IndexType size) {
+  unsigned int numLevels = 1;
+  while (getLevelSize(size, numLevels - 1) > 1) {
+    numLevels++;
+  }
+
+  return numLevels;
+}
+
+IndexType Writers::PyramidWriter::getLevelSize(IndexType size, unsigned int level) {
+  return (size + (IndexType(1) << level) - 1) >> level;
+}
+
+std::uint64_t Writers::PyramidWriter::getLevelOffset(IndexType size, unsigned int level) {
+  std::uint64_t offset = sizeof(double);
+
+  // Coarser levels come first
+  for (unsigned int l = getNumLevels(size) - 1; l > level; l--) {
+    offset += getLevelSize(size, l) * sizeof(Record);
+  }
+
+  return offset;
+}
+
+std::uint64_t Writers::PyramidWriter::getFrameBytes(IndexType size, bool fullResolution) {
+  return getLevelOffset(size, 0) + (fullResolution ? 2 * std::uint64_t(size) * sizeof(RealType) : 0);
+}
+
+Writers::PyramidWriter::PyramidWriter(const std::string& fileName, const RealType cellSize, IndexType size, bool fullResolution):
+  file_(fileName.c_str(), std::ios::out | std::ios::binary),
+  size_(size),
+  fullResolution_(fullResolution),
+  levels_(getNumLevels(size)) {
+
+  if (!file_.good()) {
+    Tools::Logger::logger.error(("Could not open output file " + fileName).c_str());
+  }
+
+  for (unsigned int level = 1; level < levels_.size(); level++) {
+    levels_[level].resize(getLevelSize(size, level));
+  }
+  if (fullResolution) {
+    full_.resize(2 * size);
+  }
+
+  const std::uint32_t header[3]      = {sizeof(RealType), static_cast<std::uint32_t>(levels_.size()), fullResolution};
+  const std::uint64_t longSize       = size;
+  const double        doubleCellSize = cellSize;
+  file_.write("SWEL", 4);
+  file_.write(reinterpret_cast<const char*>(header), sizeof(header));
+  file_.write(reinterpret_cast<const char*>(&longSize), sizeof(longSize));
+  file_.write(reinterpret_cast<const char*>(&doubleCellSize), sizeof(doubleCellSize));
+}
+
+void Writers::PyramidWriter::write(const RealType time, const RealType* h, const RealType* hu, IndexType size) {
+  if (size != size_) {
+    Tools::Logger::logger.error("Pyramid output requires a constant domain size");
+  }
+
+  const unsigned int numLevels = static_cast<unsigned int>(levels_.size());
+
+  // Level 1 in the same pass as the copy of the full resolution
+  if (numLevels > 1) {
+    std::vector<Record>& level = levels_[1];
+    for (IndexType j = 0; j < level.size(); j++) {
+      const IndexType left  = 1 + 2 * j;
+      const IndexType right = std::min(left + 1, size);
+      const RealType  count = RealType(right - left + 1);
+
+      level[j] = {
+        std::min(h[left], h[right]),
+        std::max(h[left], h[right]),
+        (left == right ? h[left] : h[left] + h[right]) / count,
+        std::min(hu[left], hu[right]),
+        std::max(hu[left], hu[right]),
+        (left == right ? hu[left] : hu[left] + hu[right]) / count};
+
+      if (fullResolution_) {
+        full_[2 * left - 2]  = h[left];
+        full_[2 * left - 1]  = hu[left];
+        full_[2 * right - 2] = h[right];
+        full_[2 * right - 1] = hu[right];
+      }
+    }
+  } else if (fullResolution_ && size > 0) {
+    full_[0] = h[1];
+    full_[1] = hu[1];
+  }
+
+  // Every further level from the previous one, the last point of a level may cover fewer cells
+  for (unsigned int l = 2; l < numLevels; l++) {
+    const std::vector<Record>& fine   = levels_[l - 1];
+    std::vector<Record>&       coarse = levels_[l];
+    const IndexType            width  = IndexType(1) << (l - 1);
+
+    for (IndexType j = 0; j < coarse.size(); j++) {
+      const IndexType left = 2 * j;
+      if (left + 1 == fine.size()) {
+        coarse[j] = fine[left];
+        continue;
+      }
+
+      const Record&  a      = fine[left];
+      const Record&  b      = fine[left + 1];
+      const RealType weight = RealType(std::min(width, size - (left + 1) * width)) / RealType(width);
+
+      coarse[j] = {
+        std::min(a.hMin, b.hMin),
+        std::max(a.hMax, b.hMax),
+        (a.hMean + weight * b.hMean) / (1 + weight),
+        std::min(a.huMin, b.huMin),
+        std::max(a.huMax, b.huMax),
+        (a.huMean + weight * b.huMean) / (1 + weight)};
+    }
+  }
+
+  const double doubleTime = time;
+  file_.write(reinterpret_cast<const char*>(&doubleTime), sizeof(doubleTime));
+  for (unsigned int l = numLevels - 1; l > 0; l--) {
+    file_.write(reinterpret_cast<const char*>(levels_[l].data()), levels_[l].size() * sizeof(Record));
+  }
+  if (fullResolution_) {
+    file_.write(reinterpret_cast<const char*>(full_.data()), full_.size() * sizeof(RealType));
+  }
+
+  file_.flush();
+}
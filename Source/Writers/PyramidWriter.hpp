@@ -0,0 +1,125 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "SWE1DExport.hpp"
+#include "Tools/IndexType.hpp"
+#include "Tools/RealType.hpp"
+#include "Writers/Writer.hpp"
+
+namespace Writers {
+
+  /**
+   * Writes a level-of-detail pyramid of h and hu for every output step
+   *
+   * Level k coarsens the field by 2^k, each point stores the minimum,
+   * maximum and mean of the cells it covers. Level 1 is computed while the
+   * full resolution is copied, every further level from the previous one.
+   * Frames have a fixed size and store the coarsest level first, so a
+   * reader can seek to any level and range without reading finer data.
+   *
+   * The levels coarsen the cell indices: on a non-uniform grid the means
+   * are not weighted with the cell widths and the cell size in the header
+   * is the mean cell size.
+   *
+   * File layout (native endianness):
+   * <pre>
+   *   header:  "SWEL" | uint32 sizeof(RealType) | uint32 numLevels | uint32 fullResolution | uint64 size | double cellSize
+   *   frame:   double time |
+   *            for level numLevels-1,..,1: Record[getLevelSize(level)] |
+   *            if fullResolution: (h, hu)[size]
+   * </pre>
+   *
+   * Tools::PyramidReader reads these files.
+   */
+  class SWE1D_EXPORT PyramidWriter: public Writer {
+  public:
+    struct Record {
+      RealType hMin;
+      RealType hMax;
+      RealType hMean;
+      RealType huMin;
+      RealType huMax;
+      RealType huMean;
+    };
+
+    static constexpr std::uint64_t HeaderBytes = 4 + 3 * sizeof(std::uint32_t) + sizeof(std::uint64_t) + sizeof(double);
+
+    /**
+     * @return Number of levels including the full resolution, the coarsest level has one point
+     */
+    static unsigned int getNumLevels(IndexType size);
+
+    /**
+     * @return Number of points of a level
+     */
+    static IndexType getLevelSize(IndexType size, unsigned int level);
+
+    /**
+     * @return Offset of a level from the beginning of a frame
+     */
+    static std::uint64_t getLevelOffset(IndexType size, unsigned int level);
+
+    static std::uint64_t getFrameBytes(IndexType size, bool fullResolution);
+
+  private:
+    std::ofstream file_;
+
+    IndexType size_;
+    bool      fullResolution_;
+
+    /** Records of the levels 1,..,numLevels-1 (index 0 is unused) */
+    std::vector<std::vector<Record>> levels_;
+    /** Interleaved h and hu of the full resolution */
+    std::vector<RealType> full_;
+
+  public:
+    /**
+     * @param size Number of cells (without boundary values)
+     * @param fullResolution Also store level 0, i.e. the complete field
+     */
+    PyramidWriter(const std::string& fileName, const RealType cellSize, IndexType size, bool fullResolution = true);
+    ~PyramidWriter() override = default;
+
+    void write(const RealType time, const RealType* h, const RealType* hu, IndexType size) override;
+  };
+
+} // namespace Writers
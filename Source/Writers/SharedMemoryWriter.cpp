@@ -0,0 +1,173 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#include "SharedMemoryWriter.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "Tools/Logger.hpp"
+
+namespace {
+
+  constexpr std::size_t CacheLineSize = 64;
+
+  std::size_t alignToCacheLine(std::size_t size) { return (size + CacheLineSize - 1) / CacheLineSize * CacheLineSize; }
+
+} // namespace
+
+std::size_t Writers::SharedMemoryWriter::getSlotOffset() { return alignToCacheLine(sizeof(Header)); }
+
+std::size_t Writers::SharedMemoryWriter::getSlotSize(unsigned int numPoints) { return alignToCacheLine(sizeof(Slot) + 2 * numPoints * sizeof(RealType)); }
+
+Writers::SharedMemoryWriter::SharedMemoryWriter(const std::string& name, const RealType cellSize, IndexType size, unsigned int maxPoints, unsigned int numSlots):
+  name_(name.empty() || name[0] != '/' ? "/" + name : name),
+  memory_(nullptr),
+  memorySize_(0),
+  header_(nullptr),
+  factor_((size + std::max(maxPoints, 1u) - 1) / std::max(maxPoints, 1u)),
+  cellSize_(cellSize),
+  numFrames_(0) {
+
+  factor_                      = std::max<IndexType>(factor_, 1);
+  numSlots                     = std::max(numSlots, 1u);
+  const unsigned int numPoints = static_cast<unsigned int>((size + factor_ - 1) / factor_);
+
+  const int fd = shm_open(name_.c_str(), O_CREAT | O_RDWR, 0644);
+  if (fd < 0) {
+    Tools::Logger::logger.error(("Could not create shared memory " + name_).c_str());
+  }
+
+  memorySize_ = getSlotOffset() + numSlots * getSlotSize(numPoints);
+  if (ftruncate(fd, static_cast<off_t>(memorySize_)) != 0) {
+    close(fd);
+    Tools::Logger::logger.error(("Could not resize shared memory " + name_).c_str());
+  }
+
+  memory_ = mmap(nullptr, memorySize_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (memory_ == MAP_FAILED) {
+    Tools::Logger::logger.error(("Could not map shared memory " + name_).c_str());
+  }
+
+  // The sequence numbers and the frame counter start at 0
+  std::memset(memory_, 0, memorySize_);
+
+  header_            = static_cast<Header*>(memory_);
+  header_->realSize  = sizeof(RealType);
+  header_->numSlots  = numSlots;
+  header_->numPoints = numPoints;
+  header_->cellSize  = cellSize * factor_;
+  header_->latest.store(0);
+
+  // Readers check the magic last
+  std::atomic_thread_fence(std::memory_order_release);
+  std::memcpy(header_->magic, "SWEM", 4);
+}
+
+Writers::SharedMemoryWriter::~SharedMemoryWriter() {
+  munmap(memory_, memorySize_);
+  // Readers that already mapped the memory keep their mapping
+  shm_unlink(name_.c_str());
+}
+
+void Writers::SharedMemoryWriter::write(const RealType time, const RealType* h, const RealType* hu, IndexType size) {
+  const unsigned int numPoints = header_->numPoints;
+  const std::size_t  slotIndex = numFrames_ % header_->numSlots;
+
+  char*     slotMemory = static_cast<char*>(memory_) + getSlotOffset() + slotIndex * getSlotSize(numPoints);
+  Slot*     slot       = reinterpret_cast<Slot*>(slotMemory);
+  RealType* hPoints    = reinterpret_cast<RealType*>(slotMemory + sizeof(Slot));
+  RealType* huPoints   = hPoints + numPoints;
+
+  // Readers retry while the sequence is odd
+  const std::uint64_t sequence = slot->sequence.load(std::memory_order_relaxed);
+  slot->sequence.store(sequence + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  RealType mass      = RealType(0.0);
+  RealType momentum  = RealType(0.0);
+  RealType maxHeight = RealType(0.0);
+  RealType maxSpeed  = RealType(0.0);
+
+  // Only set for non-uniform grids
+  const RealType* cellSizes = cellSizes_.empty() ? nullptr : cellSizes_.data();
+
+  for (unsigned int p = 0; p < numPoints; p++) {
+    const IndexType begin = 1 + p * factor_;
+    const IndexType end   = std::min(begin + factor_, size + 1);
+
+    RealType hSum   = RealType(0.0);
+    RealType huSum  = RealType(0.0);
+    RealType length = RealType(0.0);
+    for (IndexType i = begin; i < end; i++) {
+      const RealType width = cellSizes ? cellSizes[i - 1] : RealType(1.0);
+      hSum += h[i] * width;
+      huSum += hu[i] * width;
+      length += width;
+      maxHeight = std::max(maxHeight, h[i]);
+      maxSpeed  = std::max(maxSpeed, h[i] > RealType(0.0) ? std::abs(hu[i]) / h[i] : RealType(0.0));
+    }
+
+    hPoints[p]  = hSum / length;
+    huPoints[p] = huSum / length;
+    mass += hSum;
+    momentum += huSum;
+  }
+
+  slot->frame     = numFrames_;
+  slot->time      = time;
+  slot->mass      = cellSizes ? mass : mass * cellSize_;
+  slot->momentum  = cellSizes ? momentum : momentum * cellSize_;
+  slot->maxHeight = maxHeight;
+  slot->maxSpeed  = maxSpeed;
+
+  slot->sequence.store(sequence + 2, std::memory_order_release);
+
+  numFrames_++;
+  header_->latest.store(numFrames_, std::memory_order_release);
+}
+
+void Writers::SharedMemoryWriter::setCellSizes(const RealType* cellSizes, IndexType size) {
+  if (cellSizes == nullptr) {
+    cellSizes_.clear();
+  } else {
+    cellSizes_.assign(cellSizes, cellSizes + size);
+  }
+}
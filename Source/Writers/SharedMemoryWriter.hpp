@@ -0,0 +1,150 @@
+/**
+ * @file
+ *  This file is part of SWE1D
+ *
+ *  SWE1D is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SWE1D is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SWE1D.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Diese Datei ist Teil von SWE1D.
+ *
+ *  SWE1D ist Freie Software: Sie koennen es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Option) jeder spaeteren
+ *  veroeffentlichten Version, weiterverbreiten und/oder modifizieren.
+ *
+ *  SWE1D wird in der Hoffnung, dass es nuetzlich sein wird, aber
+ *  OHNE JEDE GEWAEHELEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewaehrleistung der MARKTFAEHIGKEIT oder EIGNUNG FUER EINEN BESTIMMTEN
+ *  ZWECK. Siehe die GNU General Public License fuer weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <http://www.gnu.org/licenses/>.
+ *
+ * @copyright 2026 Technische Universitaet Muenchen
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "SWE1DExport.hpp"
+#include "Tools/IndexType.hpp"
+#include "Tools/RealType.hpp"
+#include "Writers/Writer.hpp"
+
+namespace Writers {
+
+  /**
+   * Publishes downsampled frames of h and hu into a POSIX shared memory
+   * ring buffer for live monitoring (see Tools::SharedMemoryReader and
+   * SWE1D-Monitor).
+   *
+   * Every slot of the ring is protected by a seqlock: the writer makes the
+   * sequence odd, writes the frame and makes it even again. Readers copy the
+   * latest slot and retry if the sequence was odd or changed meanwhile, so
+   * the solver never waits for a reader. Each point of a frame is the mean
+   * of several cells. The total mass and momentum and the maximum height and
+   * speed are computed in the same pass.
+   *
+   * On a non-uniform grid (see setCellSizes()), the means and totals are
+   * weighted with the cell widths. The points still cover the same number of
+   * cells, their distance in the header is the mean distance.
+   */
+  class SWE1D_EXPORT SharedMemoryWriter: public Writer {
+  public:
+    struct Header {
+      /** "SWEM" */
+      char          magic[4];
+      std::uint32_t realSize;
+      std::uint32_t numSlots;
+      /** Number of points per frame */
+      std::uint32_t numPoints;
+      /** Distance of two points */
+      double cellSize;
+      /** Number of published frames, the latest frame is in slot (latest-1) % numSlots */
+      std::atomic<std::uint64_t> latest;
+    };
+
+    struct Slot {
+      /** Odd while the slot is written */
+      std::atomic<std::uint64_t> sequence;
+      std::uint64_t              frame;
+      double                     time;
+      double                     mass;
+      double                     momentum;
+      double                     maxHeight;
+      double                     maxSpeed;
+      // Followed by numPoints values of h and numPoints values of hu
+    };
+
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "Shared memory requires lock-free 64-bit atomics");
+
+    /**
+     * @return Offset of the first slot in the shared memory
+     */
+    static std::size_t getSlotOffset();
+
+    /**
+     * @return Size of one slot (a multiple of the cache line size)
+     */
+    static std::size_t getSlotSize(unsigned int numPoints);
+
+  private:
+    std::string name_;
+
+    void*       memory_;
+    std::size_t memorySize_;
+
+    Header* header_;
+
+    /** Number of cells averaged into one point */
+    IndexType factor_;
+    RealType  cellSize_;
+
+    /** Widths of the cells of a non-uniform grid (empty = uniform) */
+    std::vector<RealType> cellSizes_;
+
+    std::uint64_t numFrames_;
+
+  public:
+    /**
+     * @param name Name of the shared memory object (a leading '/' is added if missing)
+     * @param size Number of cells (without boundary values)
+     * @param maxPoints Maximum number of points per frame
+     * @param numSlots Number of frames in the ring buffer
+     */
+    SharedMemoryWriter(const std::string& name, const RealType cellSize, IndexType size, unsigned int maxPoints = 4096, unsigned int numSlots = 8);
+    ~SharedMemoryWriter() override;
+
+    SharedMemoryWriter(const SharedMemoryWriter&)            = delete;
+    SharedMemoryWriter& operator=(const SharedMemoryWriter&) = delete;
+
+    /**
+     * Publishes a downsampled frame
+     */
+    void write(const RealType time, const RealType* h, const RealType* hu, IndexType size) override;
+
+    /**
+     * Weights the means and totals with the widths of a non-uniform grid
+     *
+     * @param cellSizes Widths of the cells (without boundary values), nullptr for the uniform grid
+     * @param size Number of cells
+     */
+    void setCellSizes(const RealType* cellSizes, IndexType size);
+  };
+
+} // namespace Writers
@@ -36,9 +36,17 @@
 
 #include "VTKWriter.hpp"
 
-Writers::VTKWriter::VTKWriter(const std::string& basename, const RealType cellSize):
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "Tools/Grid.hpp"
+
+Writers::VTKWriter::VTKWriter(const std::string& basename, const RealType cellSize, unsigned int numPieces):
   basename_(basename),
   cellSize_(cellSize),
+  origin_(0),
+  numPieces_(std::max(numPieces, 1u)),
   timeStep_(0) {
 
   // Initialize VTP stream
@@ -60,14 +68,60 @@ Writers::VTKWriter::~VTKWriter() {
   delete vtpFile_;
 }
 
-void Writers::VTKWriter::write(const RealType time, const RealType* h, const RealType* hu, unsigned int size) {
+void Writers::VTKWriter::write(const RealType time, const RealType* h, const RealType* hu, IndexType size) {
+  assert(coordinates_.empty() || coordinates_.size() == size + 1);
+
+  // Small grids get fewer pieces, every piece has at least one cell
+  const unsigned int numPieces = static_cast<unsigned int>(std::max<IndexType>(std::min<IndexType>(numPieces_, size), 1));
+
   // Generate VTK file name
-  std::string fileName = generateFileName();
+  std::string fileName = generateFileName(numPieces > 1);
 
   // Add current time to VTP collection
   *vtpFile_
     << "<DataSet timestep=\"" << time << "0\" group=\"\" part=\"0\" file=\"" << fileName << "\"/> " << std::endl;
 
+  if (numPieces == 1) {
+    writePiece(fileName, h, hu, 0, size, size);
+  } else {
+    // Balanced contiguous pieces
+    std::vector<IndexType> offsets(numPieces + 1);
+    for (unsigned int p = 0; p <= numPieces; p++) {
+      offsets[p] = size / numPieces * p + std::min<IndexType>(p, size % numPieces);
+    }
+
+    // The calling thread writes the first piece
+    std::vector<std::thread> threads;
+    threads.reserve(numPieces - 1);
+    for (unsigned int p = 1; p < numPieces; p++) {
+      threads.emplace_back(&VTKWriter::writePiece, this, generatePieceFileName(p), h, hu, offsets[p], offsets[p + 1], size);
+    }
+    writePiece(generatePieceFileName(0), h, hu, offsets[0], offsets[1], size);
+
+    writeParallelFile(fileName, offsets.data(), numPieces, size);
+
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+  }
+
+  // Increment time step
+  timeStep_++;
+}
+
+void Writers::VTKWriter::setOrigin(RealType origin) { origin_ = origin; }
+
+unsigned int Writers::VTKWriter::getNumPieces() const { return numPieces_; }
+
+void Writers::VTKWriter::setCellSizes(const RealType* cellSizes, IndexType size) {
+  if (cellSizes == nullptr) {
+    coordinates_.clear();
+  } else {
+    coordinates_ = Tools::Grid::getCellFaces(cellSizes, size);
+  }
+}
+
+void Writers::VTKWriter::writePiece(const std::string& fileName, const RealType* h, const RealType* hu, IndexType begin, IndexType end, IndexType size) const {
   // Write VTK file
   std::ofstream vtkFile(fileName.c_str());
   assert(vtkFile.good());
@@ -77,13 +131,13 @@ void Writers::VTKWriter::write(const RealType time, const RealType* h, const Rea
     << "<?xml version=\"1.0\"?>" << std::endl
     << "<VTKFile type=\"RectilinearGrid\">" << std::endl
     << "<RectilinearGrid WholeExtent=\"0 " << size << " 0 0 0 0\">" << std::endl
-    << "<Piece Extent=\"0 " << size << " 0 0 0 0\">" << std::endl;
+    << "<Piece Extent=\"" << begin << " " << end << " 0 0 0 0\">" << std::endl;
 
   vtkFile << "<Coordinates>" << std::endl << "<DataArray type=\"Float32\" format=\"ascii\">" << std::endl;
 
-  // Grid points
-  for (unsigned int i = 0; i < size + 1; i++) {
-    vtkFile << cellSize_ * i << "" << std::endl;
+  // Grid points (no flush per value, the pieces should be limited by the file system only)
+  for (IndexType i = begin; i < end + 1; i++) {
+    vtkFile << origin_ + (coordinates_.empty() ? cellSize_ * i : coordinates_[i]) << '\n';
   }
 
   vtkFile << "</DataArray>" << std::endl;
@@ -104,29 +158,66 @@ void Writers::VTKWriter::write(const RealType time, const RealType* h, const Rea
 
   // Water surface height
   vtkFile << "<DataArray Name=\"h\" type=\"Float32\" format=\"ascii\">" << std::endl;
-  for (unsigned int i = 1; i < size + 1; i++) {
-    vtkFile << h[i] << std::endl;
+  for (IndexType i = begin + 1; i < end + 1; i++) {
+    vtkFile << h[i] << '\n';
   }
   vtkFile << "</DataArray>" << std::endl;
 
   // Momentum
   vtkFile << "<DataArray Name=\"hu\" type=\"Float32\" format=\"ascii\">" << std::endl;
-  for (unsigned int i = 1; i < size + 1; i++) {
-    vtkFile << hu[i] << std::endl;
+  for (IndexType i = begin + 1; i < end + 1; i++) {
+    vtkFile << hu[i] << '\n';
   }
   vtkFile << "</DataArray>" << std::endl;
 
   vtkFile << "</CellData>" << std::endl << "</Piece>" << std::endl;
 
   vtkFile << "</RectilinearGrid>" << std::endl << "</VTKFile>" << std::endl;
+}
 
-  // Increment time step
-  timeStep_++;
+void Writers::VTKWriter::writeParallelFile(const std::string& fileName, const IndexType* offsets, unsigned int numPieces, IndexType size) {
+  std::ofstream pvtkFile(fileName.c_str());
+  assert(pvtkFile.good());
+
+  pvtkFile
+    << "<?xml version=\"1.0\"?>" << std::endl
+    << "<VTKFile type=\"PRectilinearGrid\" version=\"0.1\">" << std::endl
+    << "<PRectilinearGrid WholeExtent=\"0 " << size << " 0 0 0 0\" GhostLevel=\"0\">" << std::endl;
+
+  pvtkFile
+    << "<PCoordinates>" << std::endl
+    << "<PDataArray type=\"Float32\"/>" << std::endl
+    << "<PDataArray type=\"Float32\"/>" << std::endl
+    << "<PDataArray type=\"Float32\"/>" << std::endl
+    << "</PCoordinates>" << std::endl;
+
+  pvtkFile
+    << "<PCellData>" << std::endl
+    << "<PDataArray Name=\"h\" type=\"Float32\"/>" << std::endl
+    << "<PDataArray Name=\"hu\" type=\"Float32\"/>" << std::endl
+    << "</PCellData>" << std::endl;
+
+  // The pieces are located relative to the .pvtr file
+  for (unsigned int p = 0; p < numPieces; p++) {
+    std::string source = generatePieceFileName(p);
+    source             = source.substr(source.find_last_of('/') + 1);
+
+    pvtkFile << "<Piece Extent=\"" << offsets[p] << " " << offsets[p + 1] << " 0 0 0 0\" Source=\"" << source << "\"/>" << std::endl;
+  }
+
+  pvtkFile << "</PRectilinearGrid>" << std::endl << "</VTKFile>" << std::endl;
+}
+
+std::string Writers::VTKWriter::generateFileName(bool parallel) {
+  std::ostringstream name;
+  name << basename_ << '_' << timeStep_ << (parallel ? ".pvtr" : ".vtr");
+
+  return name.str();
 }
 
-std::string Writers::VTKWriter::generateFileName() {
+std::string Writers::VTKWriter::generatePieceFileName(unsigned int piece) {
   std::ostringstream name;
-  name << basename_ << '_' << timeStep_ << ".vtr";
+  name << basename_ << '_' << timeStep_ << '_' << piece << ".vtr";
 
   return name.str();
 }
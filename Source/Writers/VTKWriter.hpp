@@ -40,21 +40,39 @@
 #include <fstream>
 #include <sstream>
 #include <string>
+#include <vector>
 
+#include "SWE1DExport.hpp"
+#include "Tools/IndexType.hpp"
 #include "Tools/RealType.hpp"
+#include "Writers/Writer.hpp"
 
 namespace Writers {
 
   /**
    * A writer class that generates VTK files
+   *
+   * With more than one piece, every time step is split into contiguous
+   * pieces that are written concurrently (one thread per piece) to
+   * separate .vtr files. A .pvtr file then describes the whole grid and
+   * is referenced from the VTP collection instead.
    */
-  class VTKWriter {
+  class SWE1D_EXPORT VTKWriter: public Writer {
   private:
     // Base name of the VTP collections and VTK files
     std::string basename_;
 
     RealType cellSize_;
 
+    // Positions of the cell faces of a non-uniform grid (empty = uniform)
+    std::vector<RealType> coordinates_;
+
+    // Position of the left face of the first cell
+    RealType origin_;
+
+    // Number of pieces per time step (1 = a single .vtr file)
+    unsigned int numPieces_;
+
     // Current time step
     unsigned int timeStep_;
 
@@ -62,20 +80,53 @@ namespace Writers {
     std::ofstream* vtpFile_;
 
     /**
+     * @param parallel Name of the .pvtr file instead of the .vtr file
      * @return The generated filename containing the time step and the real name
      */
-    std::string generateFileName();
+    std::string generateFileName(bool parallel = false);
+
+    /**
+     * @return The filename of one piece of the current time step
+     */
+    std::string generatePieceFileName(unsigned int piece);
+
+    /**
+     * Writes the cells [begin, end) to a .vtr file
+     *
+     * @param size Number of cells of the whole grid
+     */
+    void writePiece(const std::string& fileName, const RealType* h, const RealType* hu, IndexType begin, IndexType end, IndexType size) const;
+
+    /**
+     * Writes the .pvtr file that combines the pieces of the current time step
+     */
+    void writeParallelFile(const std::string& fileName, const IndexType* offsets, unsigned int numPieces, IndexType size);
 
   public:
-    VTKWriter(const std::string& basename = "SWE1D", const RealType cellSize = 1);
-    ~VTKWriter();
+    VTKWriter(const std::string& basename = "SWE1D", const RealType cellSize = 1, unsigned int numPieces = 1);
+    ~VTKWriter() override;
 
     /**
      * Writes all values to VTK file
      *
      * @param size Number of cells (without boundary values)
      */
-    void write(const RealType time, const RealType* h, const RealType* hu, unsigned int size);
+    void write(const RealType time, const RealType* h, const RealType* hu, IndexType size) override;
+
+    /**
+     * Shifts the coordinates of the following time steps, e.g. to the position of a moving window
+     */
+    void setOrigin(RealType origin) override;
+
+    unsigned int getNumPieces() const;
+
+    /**
+     * Writes the coordinates of a non-uniform grid instead of multiples of the cell size
+     *
+     * @param cellSizes Widths of the cells (without boundary values), nullptr for the uniform grid
+     * @param size Number of cells
+     */
+    void setCellSizes(const RealType* cellSizes, IndexType size);
   };
 
 } // namespace Writers
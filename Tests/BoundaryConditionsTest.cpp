@@ -0,0 +1,72 @@
+/**
+ * BoundaryConditionsTest.cpp
+ *
+ ****
+ **** Checks the ghost cells of the boundary conditions and the streamed forcing.
+ ****
+ */
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdio>
+#include <fstream>
+
+#include "Blocks/BoundaryConditions.hpp"
+#include "Tools/ForcingTable.hpp"
+
+TEST_CASE("Boundary conditions set the ghost cells", "BoundaryConditionsTest") {
+  RealType h[]  = {0, 1, 2, 3, 4, 0};
+  RealType hu[] = {0, -1, 0, 0, 2, 0};
+
+  SECTION("reflective") {
+    Blocks::ReflectiveBoundary boundary;
+    boundary.apply(Blocks::BoundaryCondition::LEFT, h, hu, 4, 0);
+    boundary.apply(Blocks::BoundaryCondition::RIGHT, h, hu, 4, 0);
+    REQUIRE(h[0] == 1);
+    REQUIRE(hu[0] == 1);
+    REQUIRE(h[5] == 4);
+    REQUIRE(hu[5] == -2);
+  }
+
+  SECTION("periodic") {
+    Blocks::PeriodicBoundary boundary;
+    boundary.apply(Blocks::BoundaryCondition::LEFT, h, hu, 4, 0);
+    boundary.apply(Blocks::BoundaryCondition::RIGHT, h, hu, 4, 0);
+    REQUIRE(h[0] == 4);
+    REQUIRE(hu[0] == 2);
+    REQUIRE(h[5] == 1);
+    REQUIRE(hu[5] == -1);
+  }
+}
+
+TEST_CASE("Forcing tables are interpolated across streamed blocks", "BoundaryConditionsTest") {
+  const char* fileName = "ForcingTableTest.csv";
+
+  // More records than one block, h(t) = 10 + t/1000
+  {
+    std::ofstream file(fileName);
+    file << "time,h" << std::endl;
+    for (unsigned int i = 0; i < 150000; i++) {
+      file << 2 * i << ',' << 10 + 2 * i / 1000.0 << '\n';
+    }
+  }
+
+  Tools::ForcingTable forcing(fileName);
+  REQUIRE_FALSE(forcing.hasMomentum());
+
+  RealType h, hu;
+  forcing.evaluate(-1, h, hu);
+  REQUIRE(h == Catch::Approx(10));
+
+  for (double t = 0.5; t < 299990; t += 17.25) {
+    forcing.evaluate(t, h, hu);
+    REQUIRE(h == Catch::Approx(10 + t / 1000));
+    REQUIRE(hu == 0);
+  }
+
+  // Constant after the last record
+  forcing.evaluate(1e9, h, hu);
+  REQUIRE(h == Catch::Approx(10 + 299998 / 1000.0));
+
+  std::remove(fileName);
+}
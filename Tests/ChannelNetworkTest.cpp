@@ -0,0 +1,118 @@
+/**
+ * ChannelNetworkTest.cpp
+ *
+ ****
+ **** Compares networks of reaches with a single channel.
+ ****
+ */
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <limits>
+
+#include "Blocks/ChannelNetwork.hpp"
+#include "Runners/Simulation.hpp"
+#include "Scenarios/DamBreakScenario.hpp"
+
+namespace {
+  /**
+   * A part of the dam break scenario starting at cell offset
+   */
+  class PartialDamBreakScenario: public Scenarios::Scenario {
+    Scenarios::DamBreakScenario scenario_;
+    unsigned int                offset_;
+
+  public:
+    PartialDamBreakScenario(unsigned int size, unsigned int offset):
+      scenario_(size),
+      offset_(offset) {}
+
+    RealType getCellSize() const override { return scenario_.getCellSize(); }
+    RealType getHeight(IndexType pos) const override { return scenario_.getHeight(pos + offset_); }
+  };
+} // namespace
+
+TEST_CASE("A chain of reaches behaves like one channel", "ChannelNetworkTest") {
+  const unsigned int size = 300;
+
+  Scenarios::DamBreakScenario scenario(size);
+  Runners::Simulation         simulation(scenario, size);
+
+  // Three reaches of different length connected in series
+  Blocks::ChannelNetwork  network(2);
+  PartialDamBreakScenario first(size, 0), second(size, 100), third(size, 220);
+  network.addReach(first, 100);
+  network.addReach(second, 120);
+  network.addReach(third, 80);
+  network.connect(network.addJunction(), 0, Blocks::BoundaryCondition::RIGHT);
+  network.connect(0, 1, Blocks::BoundaryCondition::LEFT);
+  network.connect(network.addJunction(), 1, Blocks::BoundaryCondition::RIGHT);
+  network.connect(1, 2, Blocks::BoundaryCondition::LEFT);
+
+  for (unsigned int i = 0; i < 50; i++) {
+    const RealType dt = network.step();
+    REQUIRE(dt == Catch::Approx(simulation.step()));
+  }
+
+  unsigned int offset = 0;
+  for (unsigned int reach = 0; reach < network.getNumReaches(); reach++) {
+    for (unsigned int i = 1; i <= network.getSize(reach); i++) {
+      REQUIRE(network.getHeight(reach)[i] == Catch::Approx(simulation.getHeight()[offset + i - 1]));
+      REQUIRE(network.getMomentum(reach)[i] == Catch::Approx(simulation.getMomentum()[offset + i - 1]).margin(1e-10));
+    }
+    offset += network.getSize(reach);
+  }
+}
+
+TEST_CASE("Junctions of three reaches conserve mass", "ChannelNetworkTest") {
+  Blocks::ChannelNetwork      network(3);
+  Blocks::ReflectiveBoundary  wall;
+  Scenarios::DamBreakScenario high(100);
+  PartialDamBreakScenario     low(100, 60);
+
+  network.addReach(high, 100);
+  network.addReach(low, 40);
+  network.addReach(low, 40);
+
+  const unsigned int junction = network.addJunction();
+  network.connect(junction, 0, Blocks::BoundaryCondition::RIGHT);
+  network.connect(junction, 1, Blocks::BoundaryCondition::LEFT);
+  network.connect(junction, 2, Blocks::BoundaryCondition::LEFT);
+  network.setBoundaryCondition(0, Blocks::BoundaryCondition::LEFT, &wall);
+  network.setBoundaryCondition(1, Blocks::BoundaryCondition::RIGHT, &wall);
+  network.setBoundaryCondition(2, Blocks::BoundaryCondition::RIGHT, &wall);
+
+  // Summed in double precision, so the sum adds no error of its own
+  auto mass = [&network]() {
+    double total = 0.0;
+    for (unsigned int reach = 0; reach < network.getNumReaches(); reach++) {
+      for (unsigned int i = 1; i <= network.getSize(reach); i++) {
+        total += double(network.getHeight(reach)[i]) * network.getBlock(reach).getCellSize();
+      }
+    }
+    return total;
+  };
+
+  const double tolerance = 100 * std::numeric_limits<RealType>::epsilon();
+
+  const double initialMass = mass();
+
+  // The wave of the dam break passes the junction after about 150 steps
+  SECTION("globalTimeStepping") {
+    for (unsigned int i = 0; i < 200; i++) {
+      network.step();
+    }
+    REQUIRE(mass() == Catch::Approx(initialMass).epsilon(tolerance));
+    REQUIRE(network.getHeight(2)[10] > 11);
+  }
+
+  SECTION("localTimeStepping") {
+    network.setLocalTimeStepping(true);
+    for (unsigned int i = 0; i < 200; i++) {
+      network.step();
+    }
+    REQUIRE(mass() == Catch::Approx(initialMass).epsilon(tolerance));
+    REQUIRE(network.getHeight(2)[10] > 11);
+  }
+}
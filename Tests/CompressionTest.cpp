@@ -0,0 +1,73 @@
+/**
+ * CompressionTest.cpp
+ *
+ ****
+ **** Round trips through the lossless and lossy field codecs.
+ ****
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "Tools/Compression.hpp"
+
+TEST_CASE("Compressed fields can be decoded again", "CompressionTest") {
+  // A dam break like profile with a smooth transition
+  std::vector<RealType> values(100000);
+  for (std::size_t i = 0; i < values.size(); i++) {
+    values[i] = RealType(12.5) + RealType(2.5) * std::tanh(RealType(i) / RealType(1000) - RealType(50));
+  }
+
+  SECTION("lzRoundTrip") {
+    std::vector<std::uint8_t> bytes(10000);
+    for (std::size_t i = 0; i < bytes.size(); i++) {
+      bytes[i] = static_cast<std::uint8_t>((i / 7) % 13);
+    }
+
+    const std::vector<std::uint8_t> compressed = Tools::Compression::lzCompress(bytes.data(), bytes.size());
+    REQUIRE(compressed.size() < bytes.size());
+
+    std::vector<std::uint8_t> decompressed(bytes.size());
+    REQUIRE(Tools::Compression::lzDecompress(compressed.data(), compressed.size(), decompressed.data(), decompressed.size()));
+    REQUIRE(decompressed == bytes);
+
+    // Wrong output size is detected
+    REQUIRE_FALSE(Tools::Compression::lzDecompress(compressed.data(), compressed.size(), decompressed.data(), decompressed.size() - 1));
+  }
+
+  SECTION("lossless") {
+    Tools::Compression::Mode        mode;
+    const std::vector<std::uint8_t> compressed = Tools::Compression::compress(values.data(), values.size(), Tools::Compression::LOSSLESS, 0, mode);
+    REQUIRE(mode == Tools::Compression::LOSSLESS);
+    REQUIRE(compressed.size() < values.size() * sizeof(RealType));
+
+    std::vector<RealType> decompressed(values.size());
+    REQUIRE(Tools::Compression::decompress(compressed.data(), compressed.size(), decompressed.data(), decompressed.size(), mode, 0));
+    REQUIRE(decompressed == values);
+  }
+
+  SECTION("lossy") {
+    const double tolerance = 1e-3;
+
+    Tools::Compression::Mode        mode;
+    const std::vector<std::uint8_t> compressed = Tools::Compression::compress(values.data(), values.size(), Tools::Compression::LOSSY, tolerance, mode);
+    REQUIRE(mode == Tools::Compression::LOSSY);
+    REQUIRE(compressed.size() * 20 < values.size() * sizeof(RealType));
+
+    std::vector<RealType> decompressed(values.size());
+    REQUIRE(Tools::Compression::decompress(compressed.data(), compressed.size(), decompressed.data(), decompressed.size(), mode, tolerance));
+    for (std::size_t i = 0; i < values.size(); i++) {
+      REQUIRE(std::abs(decompressed[i] - values[i]) <= tolerance * (1 + 1e-6));
+    }
+  }
+
+  SECTION("lossyFallback") {
+    values[42] = std::nan("");
+
+    Tools::Compression::Mode mode;
+    Tools::Compression::compress(values.data(), values.size(), Tools::Compression::LOSSY, 1e-3, mode);
+    REQUIRE(mode == Tools::Compression::LOSSLESS);
+  }
+}
@@ -0,0 +1,198 @@
+/**
+ * DiagnosticsTest.cpp
+ *
+ ****
+ **** Compares the diagnostics reduced in the update sweep, whole and in combined chunks, with a plain loop over the unknowns.
+ ****
+ */
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "Blocks/BoundaryConditions.hpp"
+#include "Blocks/Diagnostics.hpp"
+#include "Blocks/WavePropagationBlock.hpp"
+#include "Scenarios/DamBreakScenario.hpp"
+
+namespace {
+
+  constexpr IndexType Size = 400;
+
+  /** Not a divisor of Size, so the last chunk is shorter */
+  constexpr IndexType ChunkSize = 97;
+
+  constexpr RealType FrontThreshold = RealType(1e-3);
+
+  constexpr RealType Tolerance = 100 * std::numeric_limits<RealType>::epsilon();
+
+  struct State {
+    std::vector<RealType> h;
+    std::vector<RealType> hu;
+    std::vector<RealType> cellSizes;
+
+    State(const Scenarios::DamBreakScenario& scenario):
+      h(Size + 2),
+      hu(Size + 2),
+      cellSizes(Size) {
+      for (IndexType i = 0; i < Size + 2; i++) {
+        h[i]  = scenario.getHeight(i);
+        hu[i] = scenario.getMomentum(i);
+      }
+      for (IndexType i = 0; i < Size; i++) {
+        cellSizes[i] = scenario.getCellWidth(i + 1);
+      }
+    }
+  };
+
+  /**
+   * Reference diagnostics of the inner cells, summed in double precision
+   */
+  Blocks::Diagnostics reduce(const State& state) {
+    double mass     = 0.0;
+    double momentum = 0.0;
+
+    Blocks::Diagnostics diagnostics;
+    for (IndexType i = 1; i < Size + 1; i++) {
+      const RealType h  = state.h[i];
+      const RealType hu = state.hu[i];
+
+      mass += double(h) * state.cellSizes[i - 1];
+      momentum += double(hu) * state.cellSizes[i - 1];
+      diagnostics.maxHeight = std::max(diagnostics.maxHeight, h);
+      if (h > RealType(0.0)) {
+        diagnostics.maxSpeed = std::max(diagnostics.maxSpeed, std::abs(hu) / std::max(h, RealType(1e-12)));
+      }
+      if (std::abs(hu) > FrontThreshold) {
+        diagnostics.frontCell = i;
+      }
+    }
+
+    diagnostics.mass     = RealType(mass);
+    diagnostics.momentum = RealType(momentum);
+    return diagnostics;
+  }
+
+  void checkDiagnostics(const Blocks::Diagnostics& actual, const Blocks::Diagnostics& expected) {
+    CHECK(actual.mass == Catch::Approx(expected.mass).epsilon(Tolerance));
+    CHECK(actual.momentum == Catch::Approx(expected.momentum).epsilon(Tolerance).margin(Tolerance * expected.mass));
+    CHECK(actual.maxHeight == expected.maxHeight);
+    CHECK(actual.maxSpeed == expected.maxSpeed);
+    CHECK(actual.frontCell == expected.frontCell);
+  }
+
+} // namespace
+
+TEST_CASE("The diagnostics of the update sweep match a plain loop", "DiagnosticsTest") {
+  Blocks::ReflectiveBoundary reflective;
+
+  SECTION("Uniform grid") {
+    Scenarios::DamBreakScenario scenario(Size);
+    State                       state(scenario);
+
+    Blocks::WavePropagationBlock block(state.h.data(), state.hu.data(), Size, scenario.getCellSize());
+    block.setBoundaryConditions(&reflective, &reflective);
+    block.setDiagnosticsEnabled(true, FrontThreshold);
+
+    for (unsigned int i = 0; i < 150; i++) {
+      block.applyBoundaryConditions(0.0);
+      block.updateUnknowns(block.computeNumericalFluxes());
+      checkDiagnostics(block.getDiagnostics(), reduce(state));
+    }
+
+    // The front has not reached the end of the channel yet
+    REQUIRE(block.getDiagnostics().frontCell > Size / 2);
+    REQUIRE(block.getDiagnostics().frontCell < Size);
+  }
+
+  SECTION("Graded grid") {
+    Scenarios::DamBreakScenario scenario(Size, RealType(15), RealType(10), RealType(4));
+    State                       state(scenario);
+
+    Blocks::WavePropagationBlock block(state.h.data(), state.hu.data(), Size, scenario.getCellSize());
+    block.setBoundaryConditions(&reflective, &reflective);
+    block.setCellSizes(state.cellSizes.data());
+    block.setDiagnosticsEnabled(true, FrontThreshold);
+
+    for (unsigned int i = 0; i < 150; i++) {
+      block.applyBoundaryConditions(0.0);
+      block.updateUnknowns(block.computeNumericalFluxes());
+      checkDiagnostics(block.getDiagnostics(), reduce(state));
+    }
+  }
+}
+
+TEST_CASE("Combined diagnostics of chunks match the whole block", "DiagnosticsTest") {
+  Blocks::ReflectiveBoundary reflective;
+
+  Scenarios::DamBreakScenario scenario(Size);
+  State                       whole(scenario);
+  State                       chunked(scenario);
+
+  Blocks::WavePropagationBlock wholeBlock(whole.h.data(), whole.hu.data(), Size, scenario.getCellSize());
+  wholeBlock.setBoundaryConditions(&reflective, &reflective);
+  wholeBlock.setDiagnosticsEnabled(true, FrontThreshold);
+
+  Blocks::WavePropagationBlock chunkedBlock(chunked.h.data(), chunked.hu.data(), Size, scenario.getCellSize());
+  chunkedBlock.setBoundaryConditions(&reflective, &reflective);
+  chunkedBlock.setDiagnosticsEnabled(true, FrontThreshold);
+
+  for (unsigned int i = 0; i < 150; i++) {
+    wholeBlock.applyBoundaryConditions(0.0);
+    const RealType dt = wholeBlock.computeNumericalFluxes();
+    wholeBlock.updateUnknowns(dt);
+
+    chunkedBlock.applyBoundaryConditions(0.0);
+    REQUIRE(chunkedBlock.computeNumericalFluxes() == dt);
+
+    // Same reduction as in the chunked runners: one partial result per range, combined afterwards
+    std::vector<Blocks::Diagnostics> partials;
+    for (IndexType begin = 1; begin < Size + 1; begin += ChunkSize) {
+      partials.emplace_back();
+      chunkedBlock.updateUnknowns(dt, begin, std::min(begin + ChunkSize, Size + 1), &partials.back());
+    }
+
+    Blocks::Diagnostics diagnostics;
+    for (const Blocks::Diagnostics& partial : partials) {
+      diagnostics.combine(partial);
+    }
+
+    REQUIRE(chunked.h == whole.h);
+    REQUIRE(chunked.hu == whole.hu);
+    checkDiagnostics(diagnostics, wholeBlock.getDiagnostics());
+    checkDiagnostics(diagnostics, reduce(chunked));
+  }
+
+  // The chunks ahead of the front have no front cell, so the combined front comes from an earlier chunk
+  REQUIRE(wholeBlock.getDiagnostics().frontCell > Size / 2);
+  REQUIRE(wholeBlock.getDiagnostics().frontCell < 1 + 3 * ChunkSize);
+}
+
+TEST_CASE("Diagnostics without moving water have no front", "DiagnosticsTest") {
+  Blocks::ReflectiveBoundary reflective;
+
+  Scenarios::DamBreakScenario scenario(Size);
+  State                       state(scenario);
+
+  Blocks::WavePropagationBlock block(state.h.data(), state.hu.data(), Size, scenario.getCellSize());
+  block.setBoundaryConditions(&reflective, &reflective);
+  block.setDiagnosticsEnabled(true, std::numeric_limits<RealType>::max());
+
+  block.applyBoundaryConditions(0.0);
+  block.updateUnknowns(block.computeNumericalFluxes());
+
+  CHECK(block.getDiagnostics().frontCell == 0);
+  CHECK(block.getDiagnostics().getFrontPosition(scenario.getCellSize()) == RealType(0.0));
+  CHECK(block.getDiagnostics().maxSpeed > RealType(0.0));
+
+  // Combining with empty diagnostics does not change anything
+  Blocks::Diagnostics diagnostics = block.getDiagnostics();
+  diagnostics.combine(Blocks::Diagnostics());
+  CHECK(diagnostics.mass == block.getDiagnostics().mass);
+  CHECK(diagnostics.maxHeight == block.getDiagnostics().maxHeight);
+  CHECK(diagnostics.frontCell == 0);
+}
@@ -0,0 +1,125 @@
+/**
+ * EnvelopeTest.cpp
+ *
+ ****
+ **** Compares the envelope accumulated in the update sweep with maxima taken after every step.
+ ****
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "Blocks/BoundaryConditions.hpp"
+#include "Runners/Simulation.hpp"
+#include "Runners/ThreadPoolRunner.hpp"
+#include "Scenarios/DamBreakScenario.hpp"
+#include "Writers/EnvelopeWriter.hpp"
+
+TEST_CASE("The envelope matches the maxima of all steps", "EnvelopeTest") {
+  constexpr IndexType Size = 400;
+
+  Scenarios::DamBreakScenario scenario(Size);
+  Blocks::ReflectiveBoundary  reflective;
+  Writers::EnvelopeWriter     writer("EnvelopeTest.envelope", scenario.getCellSize());
+
+  Runners::Simulation simulation(scenario, Size);
+  simulation.setBoundaryConditions(&reflective, &reflective);
+  simulation.setEnvelopeWriter(&writer);
+
+  std::vector<RealType> maxDepth(simulation.getHeight().begin(), simulation.getHeight().end());
+  std::vector<RealType> maxSpeed(Size, RealType(0.0));
+  std::vector<RealType> arrivalTime(Size, RealType(-1.0));
+
+  for (unsigned int i = 0; i < 300; i++) {
+    simulation.step();
+
+    for (IndexType j = 0; j < Size; j++) {
+      const RealType h  = simulation.getHeight()[j];
+      const RealType hu = simulation.getMomentum()[j];
+      maxDepth[j]       = std::max(maxDepth[j], h);
+      maxSpeed[j]       = std::max(maxSpeed[j], std::abs(hu) / h);
+      if (arrivalTime[j] < 0 && std::abs(hu) > RealType(1e-3)) {
+        arrivalTime[j] = RealType(simulation.getTime());
+      }
+    }
+  }
+
+  const Blocks::Envelope& envelope  = simulation.getBlock().getEnvelope();
+  bool                    identical = true;
+  for (IndexType j = 0; j < Size; j++) {
+    identical = identical && envelope.maxDepth[j + 1] == maxDepth[j] && envelope.maxSpeed[j + 1] == maxSpeed[j] && envelope.arrivalTime[j + 1] == arrivalTime[j];
+  }
+  CHECK(identical);
+
+  // The wave has not reached the ends yet
+  CHECK(envelope.arrivalTime[1] == RealType(-1.0));
+  CHECK(envelope.arrivalTime[Size / 2] > RealType(0.0));
+
+  simulation.writeEnvelope();
+
+  std::ifstream file("EnvelopeTest.envelope", std::ios::in | std::ios::binary);
+  double        time;
+  std::uint64_t size;
+  double        cellSize;
+  file.read(reinterpret_cast<char*>(&time), sizeof(time));
+  file.read(reinterpret_cast<char*>(&size), sizeof(size));
+  file.read(reinterpret_cast<char*>(&cellSize), sizeof(cellSize));
+  std::vector<double> values(3 * Size);
+  file.read(reinterpret_cast<char*>(values.data()), values.size() * sizeof(double));
+  REQUIRE(file.good());
+
+  CHECK(time == simulation.getTime());
+  CHECK(size == Size);
+  CHECK(values[Size / 2] == envelope.maxDepth[Size / 2 + 1]);
+  CHECK(values[2 * Size + Size / 2] == envelope.arrivalTime[Size / 2 + 1]);
+
+  std::remove("EnvelopeTest.envelope");
+}
+
+TEST_CASE("The thread pool runner accumulates the same envelope", "EnvelopeTest") {
+  constexpr IndexType Size = 301;
+
+  Scenarios::DamBreakScenario scenario(Size);
+  Writers::EnvelopeWriter     writer("EnvelopeTest.csv", scenario.getCellSize());
+
+  Runners::Simulation sequential(scenario, Size);
+  Runners::Simulation pooled(scenario, Size);
+  sequential.setCheckInterval(0);
+  pooled.setCheckInterval(0);
+  sequential.setEnvelopeWriter(&writer);
+  pooled.setEnvelopeWriter(&writer, 50);
+
+  for (unsigned int i = 0; i < 100; i++) {
+    sequential.step();
+  }
+
+  Runners::ThreadPoolRunner runner(pooled, 3, false);
+  runner.run(100);
+
+  const Blocks::Envelope& expected = sequential.getBlock().getEnvelope();
+  const Blocks::Envelope& envelope = pooled.getBlock().getEnvelope();
+  CHECK(envelope.maxDepth == expected.maxDepth);
+  CHECK(envelope.maxSpeed == expected.maxSpeed);
+  CHECK(envelope.arrivalTime == expected.arrivalTime);
+
+  // Checkpoint of step 100, one line per cell
+  std::ifstream file("EnvelopeTest.csv");
+  std::string   line;
+  unsigned int  numLines = 0;
+  while (std::getline(file, line)) {
+    numLines++;
+  }
+  CHECK(numLines == Size + 1);
+
+  // Checkpoints are renamed into place
+  CHECK_FALSE(std::ifstream("EnvelopeTest.csv.tmp").good());
+
+  std::remove("EnvelopeTest.csv");
+}
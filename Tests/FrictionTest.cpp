@@ -0,0 +1,85 @@
+/**
+ * FrictionTest.cpp
+ *
+ ****
+ **** Runs uniform, very shallow flows with stiff bottom friction at the time step of the wave speed.
+ ****
+ */
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <vector>
+
+#include "Runners/Simulation.hpp"
+#include "Scenarios/Scenario.hpp"
+
+namespace {
+
+  /** Uniform flow, the net updates vanish and only the friction acts */
+  class UniformFlowScenario: public Scenarios::Scenario {
+  private:
+    RealType height_;
+    RealType momentum_;
+
+  public:
+    UniformFlowScenario(RealType height, RealType momentum):
+      height_(height),
+      momentum_(momentum) {}
+
+    RealType getCellSize() const override { return RealType(10.0); }
+    RealType getHeight(IndexType /*pos*/) const override { return height_; }
+    RealType getMomentum(IndexType /*pos*/) const override { return momentum_; }
+  };
+
+} // namespace
+
+TEST_CASE("Friction is stable for large time steps in shallow water", "FrictionTest") {
+  const RealType h  = RealType(0.02);
+  const RealType u0 = RealType(1.0);
+
+  UniformFlowScenario scenario(h, h * u0);
+
+  // Time step of the wave speed, the friction would limit an explicit scheme to dt < 2/(k*u0)
+  const RealType cflTimeStep = scenario.getCellSize() * RealType(0.4) / (u0 + std::sqrt(RealType(9.81) * h));
+
+  SECTION("manning") {
+    const RealType n = RealType(0.1);
+    const RealType k = RealType(9.81) * n * n / (h * std::cbrt(h));
+    REQUIRE(cflTimeStep * k * u0 > 10);
+
+    Runners::Simulation simulation(scenario, 100);
+    simulation.getBlock().setFriction(Blocks::WavePropagationBlock::MANNING, n);
+
+    REQUIRE(simulation.step() == Catch::Approx(cflTimeStep));
+
+    for (unsigned int i = 0; i < 20; i++) {
+      simulation.step();
+    }
+
+    // The update is the exact solution u(t) = u0/(1 + k*u0*t) for uniform flow
+    const RealType u = u0 / (RealType(1.0) + k * u0 * static_cast<RealType>(simulation.getTime()));
+    for (unsigned int i = 0; i < 100; i++) {
+      REQUIRE(simulation.getHeight()[i] == Catch::Approx(h));
+      REQUIRE(simulation.getMomentum()[i] > 0);
+      REQUIRE(simulation.getMomentum()[i] == Catch::Approx(h * u).epsilon(1e-6));
+    }
+  }
+
+  SECTION("chezyPerCell") {
+    std::vector<RealType> coefficients(100, RealType(5.0));
+    coefficients[0] = RealType(1e6);
+
+    Runners::Simulation simulation(scenario, 100);
+    simulation.getBlock().setFriction(Blocks::WavePropagationBlock::CHEZY, coefficients.data());
+
+    const RealType dt = simulation.step();
+    REQUIRE(dt == Catch::Approx(cflTimeStep));
+
+    // The friction only slows the flow down, it never reverses it
+    const RealType k = RealType(9.81) / (25 * h);
+    REQUIRE(simulation.getMomentum()[50] == Catch::Approx(h * u0 / (1 + dt * k * u0)));
+    REQUIRE(simulation.getMomentum()[50] > 0);
+    REQUIRE(simulation.getMomentum()[0] > simulation.getMomentum()[50]);
+  }
+}
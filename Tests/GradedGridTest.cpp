@@ -0,0 +1,179 @@
+/**
+ * GradedGridTest.cpp
+ *
+ ****
+ **** Tests the non-uniform grid: cell widths of the scenario, conservation and the CFL condition.
+ ****
+ */
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Blocks/BoundaryConditions.hpp"
+#include "Runners/Simulation.hpp"
+#include "Runners/ThreadPoolRunner.hpp"
+#include "Scenarios/DamBreakScenario.hpp"
+#include "Tools/Grid.hpp"
+#include "Writers/DiagnosticsWriter.hpp"
+#include "Writers/EnvelopeWriter.hpp"
+
+TEST_CASE("The graded dam break grid covers the channel", "GradedGridTest") {
+  constexpr IndexType Size = 200;
+
+  Scenarios::DamBreakScenario scenario(Size, RealType(15), RealType(10), RealType(4));
+  REQUIRE(!scenario.isUniform());
+
+  RealType length   = RealType(0.0);
+  RealType minWidth = scenario.getCellWidth(1);
+  RealType maxWidth = scenario.getCellWidth(1);
+  for (IndexType i = 1; i < Size + 1; i++) {
+    length += scenario.getCellWidth(i);
+    minWidth = std::min(minWidth, scenario.getCellWidth(i));
+    maxWidth = std::max(maxWidth, scenario.getCellWidth(i));
+
+    // Symmetric around the dam
+    CHECK(scenario.getCellWidth(i) == scenario.getCellWidth(Size + 1 - i));
+  }
+
+  CHECK(length == Catch::Approx(1000));
+  CHECK(maxWidth / minWidth == Catch::Approx(4).epsilon(0.01));
+  CHECK(scenario.getCellWidth(Size / 2) == minWidth);
+  CHECK(scenario.getCellWidth(0) == scenario.getCellWidth(1));
+
+  CHECK(Scenarios::DamBreakScenario(Size).isUniform());
+}
+
+TEST_CASE("Equal cell widths give the uniform solution", "GradedGridTest") {
+  constexpr IndexType Size = 300;
+
+  Scenarios::DamBreakScenario scenario(Size);
+  Runners::Simulation         uniform(scenario, Size);
+  Runners::Simulation         graded(scenario, Size);
+
+  const std::vector<RealType> cellSizes(Size, scenario.getCellSize());
+  graded.getBlock().setCellSizes(cellSizes.data());
+  CHECK(!graded.getBlock().isUniform());
+
+  for (unsigned int i = 0; i < 200; i++) {
+    const RealType dt = uniform.step();
+    CHECK(graded.step() == Catch::Approx(dt));
+  }
+
+  RealType maxDifference = RealType(0.0);
+  for (IndexType i = 0; i < Size; i++) {
+    maxDifference = std::max(maxDifference, std::abs(uniform.getHeight()[i] - graded.getHeight()[i]));
+  }
+  // dt/dx and dt*(1/dx) differ by round-off only
+  CHECK(maxDifference < RealType(1e4) * std::numeric_limits<RealType>::epsilon());
+}
+
+TEST_CASE("The time step is limited by the smallest cell", "GradedGridTest") {
+  constexpr IndexType Size = 100;
+
+  // Lake at rest, all waves have the speed sqrt(g*h)
+  Scenarios::DamBreakScenario scenario(Size, RealType(10), RealType(10), RealType(3));
+  Runners::Simulation         simulation(scenario, Size);
+  REQUIRE(!simulation.getBlock().isUniform());
+
+  const std::vector<RealType>& cellSizes = simulation.getBlock().getCellSizes();
+  const RealType               minWidth  = *std::min_element(cellSizes.begin(), cellSizes.end());
+
+  const RealType dt = simulation.step();
+  CHECK(dt == Catch::Approx(RealType(0.4) * minWidth / std::sqrt(RealType(9.81) * RealType(10))));
+  CHECK(dt < RealType(0.4) * scenario.getCellSize() / std::sqrt(RealType(9.81) * RealType(10)));
+}
+
+TEST_CASE("Mass is conserved on a graded grid", "GradedGridTest") {
+  constexpr IndexType Size = 400;
+
+  Scenarios::DamBreakScenario scenario(Size, RealType(15), RealType(10), RealType(8));
+  Blocks::ReflectiveBoundary  reflective;
+
+  Runners::Simulation simulation(scenario, Size);
+  simulation.setBoundaryConditions(&reflective, &reflective);
+  simulation.getBlock().setDiagnosticsEnabled(true);
+
+  RealType initialMass = RealType(0.0);
+  for (IndexType i = 0; i < Size; i++) {
+    initialMass += simulation.getHeight()[i] * scenario.getCellWidth(i + 1);
+  }
+  CHECK(initialMass == Catch::Approx(12500));
+
+  // The parallel sweep reduces the same CFL condition
+  {
+    Runners::ThreadPoolRunner runner(simulation, 3);
+    runner.run(500);
+  }
+
+  // The mass of the diagnostics is integrated with the cell widths
+  simulation.step();
+  const Blocks::Diagnostics& diagnostics = simulation.getBlock().getDiagnostics();
+  CHECK(diagnostics.mass == Catch::Approx(initialMass).epsilon(100 * std::numeric_limits<RealType>::epsilon()));
+
+  RealType mass = RealType(0.0);
+  for (IndexType i = 0; i < Size; i++) {
+    mass += simulation.getHeight()[i] * scenario.getCellWidth(i + 1);
+  }
+  CHECK(mass == Catch::Approx(initialMass).epsilon(100 * std::numeric_limits<RealType>::epsilon()));
+
+  // The waves have spread from the dam
+  CHECK(simulation.getHeight()[Size / 2] < RealType(15));
+  CHECK(simulation.getHeight()[Size / 2] > RealType(10));
+}
+
+TEST_CASE("The envelope and the diagnostics use the cell centers of the graded grid", "GradedGridTest") {
+  constexpr IndexType Size = 60;
+
+  Scenarios::DamBreakScenario scenario(Size, RealType(15), RealType(10), RealType(4));
+  Runners::Simulation         simulation(scenario, Size);
+
+  const std::vector<RealType> cellSizes(simulation.getBlock().getCellSizes().begin() + 1, simulation.getBlock().getCellSizes().end() - 1);
+  const std::vector<RealType> centers = Tools::Grid::getCellCenters(cellSizes.data(), Size);
+  CHECK(centers.front() == Catch::Approx(cellSizes.front() / 2));
+  CHECK(centers.back() == Catch::Approx(1000 - cellSizes.back() / 2));
+
+  Writers::EnvelopeWriter envelopeWriter("GradedGridTest_envelope.csv", scenario.getCellSize());
+  envelopeWriter.setCellSizes(cellSizes.data(), Size);
+  simulation.setEnvelopeWriter(&envelopeWriter);
+
+  {
+    Writers::DiagnosticsWriter diagnosticsWriter("GradedGridTest_diagnostics.csv", scenario.getCellSize());
+    diagnosticsWriter.setCellSizes(cellSizes.data(), Size);
+    simulation.setDiagnosticsWriter(&diagnosticsWriter);
+
+    for (unsigned int i = 0; i < 20; i++) {
+      simulation.step();
+    }
+    simulation.setDiagnosticsWriter(nullptr);
+  }
+  simulation.writeEnvelope();
+
+  // The front moved right from the dam, it is located at the center of its cell
+  const Blocks::Diagnostics& diagnostics = simulation.getBlock().getDiagnostics();
+  REQUIRE(diagnostics.frontCell > Size / 2);
+  CHECK(simulation.getFrontPosition(diagnostics) == centers[diagnostics.frontCell - 1]);
+
+  std::ifstream diagnosticsFile("GradedGridTest_diagnostics.csv");
+  std::string   line, lastLine;
+  while (std::getline(diagnosticsFile, line)) {
+    lastLine = line;
+  }
+  const double frontPosition = std::stod(lastLine.substr(lastLine.find_last_of(',') + 1));
+  CHECK(frontPosition == Catch::Approx(centers[diagnostics.frontCell - 1]));
+
+  std::ifstream envelopeFile("GradedGridTest_envelope.csv");
+  std::getline(envelopeFile, line);
+  CHECK(line == "x,maxDepth,maxSpeed,arrivalTime");
+  for (IndexType i = 0; i < Size; i++) {
+    REQUIRE(std::getline(envelopeFile, line));
+    CHECK(std::stod(line.substr(0, line.find(','))) == Catch::Approx(centers[i]));
+  }
+}
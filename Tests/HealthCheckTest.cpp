@@ -0,0 +1,111 @@
+/**
+ * HealthCheckTest.cpp
+ *
+ ****
+ **** Checks the health scan: first bad cell for NaN, Inf and negative heights, the conserved totals and the scan interval.
+ ****
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <limits>
+#include <vector>
+
+#include "Tools/HealthCheck.hpp"
+
+namespace {
+
+  /** Two full scan blocks of 1024 cells followed by a partial block */
+  constexpr IndexType Size = 2 * 1024 + 37;
+
+  struct State {
+    std::vector<RealType> h;
+    std::vector<RealType> hu;
+
+    State():
+      h(Size + 2),
+      hu(Size + 2) {
+      // Multiples of 0.25 keep the sums exact in any order, even in single precision
+      for (IndexType i = 0; i < Size + 2; i++) {
+        h[i]  = RealType(1.0) + RealType(0.25) * RealType(i % 4);
+        hu[i] = RealType(0.25) * RealType(i % 3) - RealType(0.25);
+      }
+    }
+  };
+
+} // namespace
+
+TEST_CASE("The health scan accumulates the conserved totals", "HealthCheckTest") {
+  State state;
+
+  // Bad values in the boundary cells are ignored
+  state.h[0]         = -RealType(1.0);
+  state.hu[Size + 1] = std::numeric_limits<RealType>::quiet_NaN();
+
+  double mass     = 0.0;
+  double momentum = 0.0;
+  for (IndexType i = 1; i < Size + 1; i++) {
+    mass += state.h[i];
+    momentum += state.hu[i];
+  }
+
+  const Tools::HealthCheck::Report report = Tools::HealthCheck::scan(state.h.data(), state.hu.data(), Size);
+  CHECK(report.healthy);
+  CHECK(report.mass == RealType(mass));
+  CHECK(report.momentum == RealType(momentum));
+
+  // Dry cells are healthy
+  state.h[1] = RealType(0.0);
+  CHECK(Tools::HealthCheck::scan(state.h.data(), state.hu.data(), Size).healthy);
+}
+
+TEST_CASE("The health scan reports the first bad cell", "HealthCheckTest") {
+  // Cells in the first block, in a later full block and in the partial block at the end
+  for (const IndexType cell : {IndexType(1), IndexType(700), IndexType(1500), IndexType(2048), IndexType(2049), IndexType(Size - 3), IndexType(Size)}) {
+    State nan;
+    nan.h[cell] = std::numeric_limits<RealType>::quiet_NaN();
+
+    State inf;
+    inf.hu[cell] = -std::numeric_limits<RealType>::infinity();
+
+    State negative;
+    negative.h[cell] = -RealType(0.25);
+
+    for (State* state : {&nan, &inf, &negative}) {
+      const Tools::HealthCheck::Report report = Tools::HealthCheck::scan(state->h.data(), state->hu.data(), Size);
+      CHECK_FALSE(report.healthy);
+      CHECK(report.firstBadCell == cell);
+    }
+  }
+
+  SECTION("Only the first of several bad cells is reported") {
+    State state;
+    state.h[Size - 1] = -RealType(1.0);
+    state.h[2000]     = std::numeric_limits<RealType>::infinity();
+    state.hu[1800]    = std::numeric_limits<RealType>::quiet_NaN();
+
+    const Tools::HealthCheck::Report report = Tools::HealthCheck::scan(state.h.data(), state.hu.data(), Size);
+    CHECK_FALSE(report.healthy);
+    CHECK(report.firstBadCell == 1800);
+  }
+}
+
+TEST_CASE("The health check only scans in due steps", "HealthCheckTest") {
+  State state;
+
+  Tools::HealthCheck healthCheck(10);
+  CHECK(healthCheck.isDue(0));
+  CHECK_FALSE(healthCheck.isDue(5));
+  CHECK(healthCheck.isDue(20));
+
+  CHECK_FALSE(healthCheck.check(7, 0.7, state.h.data(), state.hu.data(), Size));
+  CHECK(healthCheck.check(30, 3.0, state.h.data(), state.hu.data(), Size));
+
+  // A due step with a bad state would abort, a step in between does not even look at it
+  state.h[Size] = std::numeric_limits<RealType>::quiet_NaN();
+  CHECK_FALSE(healthCheck.check(31, 3.1, state.h.data(), state.hu.data(), Size));
+
+  Tools::HealthCheck disabled(0);
+  CHECK_FALSE(disabled.isDue(0));
+  CHECK_FALSE(disabled.check(0, 0.0, state.h.data(), state.hu.data(), Size));
+}
@@ -0,0 +1,104 @@
+/**
+ * MovingWindowTest.cpp
+ *
+ ****
+ **** Compares the moving window with the simulation of the whole channel.
+ ****
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+#include <vector>
+
+#include "Blocks/BoundaryConditions.hpp"
+#include "Runners/MovingWindowSimulation.hpp"
+#include "Runners/Simulation.hpp"
+#include "Scenarios/DamBreakScenario.hpp"
+#include "Writers/Writer.hpp"
+
+namespace {
+
+  /** Collects the trail of the window */
+  class TrailWriter: public Writers::Writer {
+  public:
+    std::vector<RealType> h;
+
+    void write(const RealType /*time*/, const RealType* height, const RealType* /*momentum*/, IndexType size) override { h.insert(h.end(), height + 1, height + size + 1); }
+  };
+
+  /** Records the origins of the field output */
+  class OriginWriter: public Writers::Writer {
+  public:
+    RealType              origin = RealType(-1);
+    std::vector<RealType> origins;
+
+    void setOrigin(RealType newOrigin) override { origin = newOrigin; }
+
+    void write(const RealType /*time*/, const RealType* /*height*/, const RealType* /*momentum*/, IndexType /*size*/) override { origins.push_back(origin); }
+  };
+
+} // namespace
+
+TEST_CASE("A window covering the whole channel matches the simulation", "MovingWindowTest") {
+  constexpr IndexType Size = 500;
+
+  Scenarios::DamBreakScenario     scenario(Size);
+  Blocks::ReflectiveBoundary      reflective;
+  Runners::Simulation             simulation(scenario, Size);
+  Runners::MovingWindowSimulation window(scenario, Size, Size);
+  simulation.setBoundaryConditions(&reflective, nullptr);
+  window.setBoundaryConditions(&reflective, nullptr);
+
+  for (unsigned int i = 0; i < 200; i++) {
+    REQUIRE(window.step() == simulation.step());
+  }
+  CHECK(window.getWindowBegin() == 0);
+
+  bool identical = true;
+  for (IndexType i = 0; i < Size; i++) {
+    identical = identical && window.getHeight()[i] == simulation.getHeight()[i] && window.getMomentum()[i] == simulation.getMomentum()[i];
+  }
+  CHECK(identical);
+}
+
+TEST_CASE("The window follows the front", "MovingWindowTest") {
+  constexpr IndexType Size   = 4000;
+  constexpr IndexType Window = 400;
+  constexpr IndexType Begin  = Size / 2 - Window / 4;
+
+  Scenarios::DamBreakScenario     scenario(Size);
+  Runners::MovingWindowSimulation window(scenario, Size, Window, Begin, 50);
+  TrailWriter                     trail;
+  OriginWriter                    field;
+  window.setTrailWriter(&trail);
+  window.addWriter(field, 1000000);
+  window.writeOutput();
+
+  for (unsigned int i = 0; i < 2500; i++) {
+    window.step();
+  }
+  window.writeOutput();
+  // Several shifts, including a copy back to the beginning of the buffer
+  REQUIRE(window.getWindowBegin() > Begin + 10 * 50);
+  CHECK(window.getSize() == Window);
+  CHECK(trail.h.size() == window.getWindowBegin() - Begin);
+
+  // The field output is placed at the position of the window
+  REQUIRE(field.origins.size() == 2);
+  CHECK(field.origins[0] == RealType(Begin) * scenario.getCellSize());
+  CHECK(field.origins[1] == RealType(window.getWindowBegin()) * scenario.getCellSize());
+
+  Runners::Simulation simulation(scenario, Size);
+  simulation.advanceTo(window.getTime());
+
+  // The front stays inside the window and matches the full simulation
+  const IndexType offset = window.getWindowBegin();
+  RealType        error  = 0;
+  for (IndexType i = 0; i < Window; i++) {
+    error = std::max(error, std::abs(window.getHeight()[i] - simulation.getHeight()[offset + i]));
+  }
+  CHECK(error < RealType(1e-2));
+  CHECK(std::abs(window.getHeight()[Window - 1] - RealType(10)) < RealType(1e-3));
+  CHECK(window.getHeight()[Window / 2] > RealType(10.5));
+}
@@ -0,0 +1,69 @@
+/**
+ * OutOfCoreTest.cpp
+ *
+ ****
+ **** Compares the chunked simulation on a memory-mapped file with the in-memory simulation.
+ ****
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+#include "Blocks/BoundaryConditions.hpp"
+#include "Runners/OutOfCoreSimulation.hpp"
+#include "Runners/Simulation.hpp"
+#include "Scenarios/DamBreakScenario.hpp"
+#include "Writers/PyramidWriter.hpp"
+
+TEST_CASE("The out-of-core simulation matches the in-memory simulation", "OutOfCoreTest") {
+  constexpr IndexType Size = 500;
+
+  Scenarios::DamBreakScenario scenario(Size);
+  Blocks::ReflectiveBoundary  reflective;
+
+  for (const IndexType chunkSize : {IndexType(1), IndexType(7), IndexType(64), Size}) {
+    Runners::Simulation          simulation(scenario, Size);
+    Runners::OutOfCoreSimulation outOfCore(scenario, Size, "OutOfCoreTest.state", chunkSize);
+    simulation.setBoundaryConditions(&reflective, nullptr);
+    outOfCore.setBoundaryConditions(&reflective, nullptr);
+
+    for (unsigned int i = 0; i < 60; i++) {
+      REQUIRE(outOfCore.step() == simulation.step());
+    }
+    REQUIRE(outOfCore.getTime() == simulation.getTime());
+
+    bool identical = true;
+    for (IndexType i = 0; i < Size; i++) {
+      identical = identical && outOfCore.getHeight()[i] == simulation.getHeight()[i] && outOfCore.getMomentum()[i] == simulation.getMomentum()[i];
+    }
+    CHECK(identical);
+  }
+
+  // The state file holds h and hu including the ghost cells
+  std::vector<RealType> state(2 * (Size + 2));
+  std::ifstream         file("OutOfCoreTest.state", std::ios::in | std::ios::binary);
+  file.read(reinterpret_cast<char*>(state.data()), state.size() * sizeof(RealType));
+  REQUIRE(file.good());
+
+  Runners::Simulation simulation(scenario, Size);
+  simulation.setBoundaryConditions(&reflective, nullptr);
+  for (unsigned int i = 0; i < 60; i++) {
+    simulation.step();
+  }
+  CHECK(state[1] == simulation.getHeight()[0]);
+  CHECK(state[Size] == simulation.getHeight()[Size - 1]);
+  CHECK(state[Size + 2 + 250] == simulation.getMomentum()[249]);
+
+  std::remove("OutOfCoreTest.state");
+}
+
+TEST_CASE("Sizes beyond 32 bit are indexed correctly", "OutOfCoreTest") {
+  const IndexType size = (IndexType(5) << 32) + 3;
+
+  REQUIRE(Writers::PyramidWriter::getLevelSize(size, 0) == size);
+  REQUIRE(Writers::PyramidWriter::getLevelSize(size, 1) == (IndexType(5) << 31) + 2);
+  REQUIRE(Writers::PyramidWriter::getNumLevels(size) == 36);
+}
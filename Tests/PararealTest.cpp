@@ -0,0 +1,53 @@
+/**
+ * PararealTest.cpp
+ *
+ ****
+ **** Checks that Parareal converges to the serial solution.
+ ****
+ */
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "Blocks/BoundaryConditions.hpp"
+#include "Runners/PararealRunner.hpp"
+#include "Scenarios/DamBreakScenario.hpp"
+
+TEST_CASE("Parareal converges to the serial solution", "PararealTest") {
+  constexpr IndexType Size    = 400;
+  constexpr double    EndTime = 8.0;
+
+  Scenarios::DamBreakScenario scenario(Size);
+  Blocks::ReflectiveBoundary  reflective;
+
+  SECTION("exactAfterAllSlices") {
+    Runners::PararealRunner parareal(scenario, Size, 4, 4, 2);
+    parareal.setBoundaryConditions(&reflective, nullptr);
+    parareal.runSerial(EndTime);
+
+    REQUIRE(parareal.run(EndTime, 10, 0.0) == 4);
+
+    const std::vector<Runners::PararealRunner::Iteration>& iterations = parareal.getIterations();
+    REQUIRE(iterations.size() == 4);
+    REQUIRE(iterations.front().maxError > 0.0);
+    REQUIRE(iterations.back().maxError == 0.0);
+    REQUIRE(iterations.back().maxError <= iterations.front().maxError);
+  }
+
+  SECTION("tolerance") {
+    Runners::PararealRunner parareal(scenario, Size, 8, 2, 3);
+    parareal.setBoundaryConditions(&reflective, nullptr);
+
+    const unsigned int numIterations = parareal.run(EndTime, 8, 1e-2);
+    REQUIRE(numIterations < 8);
+    REQUIRE(parareal.getIterations().back().maxUpdate <= 1e-2);
+    REQUIRE(parareal.getIterations().back().maxError < 0.0);
+
+    // Mass is conserved by both propagators
+    double mass = 0;
+    for (const RealType h : parareal.getHeight()) {
+      mass += h;
+    }
+    REQUIRE(mass == Catch::Approx(200 * 15 + 200 * 10).epsilon(1e-6));
+  }
+}
@@ -0,0 +1,172 @@
+/**
+ * ProbeWriterTest.cpp
+ *
+ ****
+ **** Checks the mapping of probe positions to cells, the interpolation weights and the chunked output of the probe writer.
+ ****
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "Writers/ProbeWriter.hpp"
+
+namespace {
+
+  constexpr IndexType Size = 10;
+
+  constexpr RealType CellSize = RealType(2.5);
+
+  /**
+   * h grows linearly with the cell index, so interpolated samples are the
+   * position relative to the cell centers, s = x / dx + 0.5
+   */
+  struct State {
+    std::vector<RealType> h;
+    std::vector<RealType> hu;
+
+    State():
+      h(Size + 2),
+      hu(Size + 2) {
+      for (IndexType i = 0; i < Size + 2; i++) {
+        h[i]  = RealType(i);
+        hu[i] = -RealType(2 * i);
+      }
+    }
+  };
+
+  /**
+   * @return All records of a binary probe file
+   */
+  std::vector<double> readRecords(const std::string& fileName) {
+    const std::size_t   fileSize = std::filesystem::file_size(fileName);
+    std::vector<double> values(fileSize / sizeof(double));
+
+    std::ifstream file(fileName, std::ios::binary);
+    file.read(reinterpret_cast<char*>(values.data()), values.size() * sizeof(double));
+    return values;
+  }
+
+  /**
+   * @return The h samples of the first record of a binary probe file
+   */
+  std::vector<double> sample(const std::vector<RealType>& positions, bool interpolate) {
+    State state;
+    {
+      Writers::ProbeWriter writer("ProbeWriterTest.probes", positions, CellSize, Size, interpolate);
+      writer.write(RealType(0.5), state.h.data(), state.hu.data(), Size);
+    }
+
+    const std::vector<double> record = readRecords("ProbeWriterTest.probes");
+    std::remove("ProbeWriterTest.probes");
+
+    REQUIRE(record.size() == 1 + 2 * positions.size());
+    CHECK(record[0] == 0.5);
+
+    std::vector<double> h;
+    for (std::size_t j = 0; j < positions.size(); j++) {
+      // hu is h scaled by -2 in every cell, so the weights are the same
+      CHECK(record[2 + 2 * j] == -2 * record[1 + 2 * j]);
+      h.push_back(record[1 + 2 * j]);
+    }
+    return h;
+  }
+
+} // namespace
+
+TEST_CASE("Probes interpolate between the cell centers", "ProbeWriterTest") {
+  // Before the first center, at the first center, on a face, between a face and a center, in the middle, at the last center, at the end and beyond both ends
+  const std::vector<RealType> positions = {
+    RealType(0.0), RealType(1.25), RealType(2.5), RealType(3.125), RealType(10.0), RealType(23.75), RealType(25.0), RealType(-3.0), RealType(30.0)};
+
+  const std::vector<double> h = sample(positions, true);
+  CHECK(h[0] == 1.0);
+  CHECK(h[1] == 1.0);
+  CHECK(h[2] == 1.5);
+  CHECK(h[3] == 1.75);
+  CHECK(h[4] == 4.5);
+  CHECK(h[5] == 10.0);
+  CHECK(h[6] == 10.0);
+  CHECK(h[7] == 1.0);
+  CHECK(h[8] == 10.0);
+
+  for (std::size_t j = 0; j < positions.size(); j++) {
+    CHECK(h[j] == std::clamp(double(positions[j] / CellSize) + 0.5, 1.0, double(Size)));
+  }
+}
+
+TEST_CASE("Probes without interpolation take the containing cell", "ProbeWriterTest") {
+  const std::vector<RealType> positions = {RealType(0.0), RealType(2.4), RealType(2.5), RealType(13.0), RealType(24.9), RealType(25.0), RealType(-3.0), RealType(30.0)};
+
+  const std::vector<double> h = sample(positions, false);
+  CHECK(h[0] == 1.0);
+  CHECK(h[1] == 1.0);
+  CHECK(h[2] == 2.0);
+  CHECK(h[3] == 6.0);
+  CHECK(h[4] == 10.0);
+  CHECK(h[5] == 10.0);
+  CHECK(h[6] == 1.0);
+  CHECK(h[7] == 10.0);
+}
+
+TEST_CASE("Probe samples are written in chunks", "ProbeWriterTest") {
+  constexpr unsigned int ChunkSize  = 4096;
+  constexpr std::size_t  RecordSize = 1 + 2 * 2;
+
+  State                       state;
+  const std::vector<RealType> positions = {RealType(5.0), RealType(20.0)};
+
+  {
+    Writers::ProbeWriter writer("ProbeWriterTest.probes", positions, CellSize, Size);
+
+    for (unsigned int n = 0; n < ChunkSize; n++) {
+      writer.write(RealType(n), state.h.data(), state.hu.data(), Size);
+    }
+    CHECK(std::filesystem::file_size("ProbeWriterTest.probes") == 0);
+
+    // The first step of the next chunk writes the full one
+    state.h[3] = RealType(100.0);
+    writer.write(RealType(ChunkSize), state.h.data(), state.hu.data(), Size);
+    CHECK(std::filesystem::file_size("ProbeWriterTest.probes") == ChunkSize * RecordSize * sizeof(double));
+  }
+
+  // The destructor writes the remaining step
+  const std::vector<double> records = readRecords("ProbeWriterTest.probes");
+  std::remove("ProbeWriterTest.probes");
+
+  REQUIRE(records.size() == (ChunkSize + 1) * RecordSize);
+  CHECK(records[(ChunkSize - 1) * RecordSize] == ChunkSize - 1);
+  CHECK(records[(ChunkSize - 1) * RecordSize + 1] == 2.5);
+  CHECK(records[ChunkSize * RecordSize] == ChunkSize);
+  CHECK(records[ChunkSize * RecordSize + 1] == 0.5 * 2 + 0.5 * 100);
+}
+
+TEST_CASE("CSV probe files have a header and one line per step", "ProbeWriterTest") {
+  State                       state;
+  const std::vector<RealType> positions = {RealType(5.0)};
+
+  {
+    Writers::ProbeWriter writer("ProbeWriterTest.csv", positions, CellSize, Size, true, 2);
+    for (unsigned int n = 0; n < 5; n++) {
+      writer.write(RealType(n), state.h.data(), state.hu.data(), Size);
+    }
+  }
+
+  std::ifstream            file("ProbeWriterTest.csv");
+  std::vector<std::string> lines;
+  for (std::string line; std::getline(file, line);) {
+    lines.push_back(line);
+  }
+  std::remove("ProbeWriterTest.csv");
+
+  REQUIRE(lines.size() == 6);
+  CHECK(lines[0] == "time,h@5,hu@5");
+  CHECK(lines[1] == "0,2.5,-5");
+  CHECK(lines[5] == "4,2.5,-5");
+}
@@ -0,0 +1,78 @@
+/**
+ * PyramidTest.cpp
+ *
+ ****
+ **** Writes a level-of-detail pyramid and reads levels and ranges back.
+ ****
+ */
+
+#include <algorithm>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdio>
+#include <numeric>
+#include <vector>
+
+#include "Tools/PyramidReader.hpp"
+#include "Writers/PyramidWriter.hpp"
+
+TEST_CASE("Pyramid levels contain min, max and mean of the covered cells", "PyramidTest") {
+  // Not a power of two, the last point of most levels covers fewer cells
+  const unsigned int size = 37;
+
+  std::vector<RealType> h(size + 2), hu(size + 2);
+  for (unsigned int i = 1; i < size + 1; i++) {
+    h[i]  = RealType((i * 7) % 11);
+    hu[i] = -RealType(i);
+  }
+
+  REQUIRE(Writers::PyramidWriter::getNumLevels(size) == 7);
+  REQUIRE(Writers::PyramidWriter::getLevelSize(size, 3) == 5);
+
+  {
+    Writers::PyramidWriter writer("PyramidTest.lod", RealType(0.5), size);
+    writer.write(RealType(1.0), h.data(), hu.data(), size);
+
+    std::fill(h.begin(), h.end(), RealType(3.0));
+    writer.write(RealType(2.0), h.data(), hu.data(), size);
+  }
+
+  Tools::PyramidReader reader("PyramidTest.lod");
+  REQUIRE(reader.getNumFrames() == 2);
+  REQUIRE(reader.getNumLevels() == 7);
+  REQUIRE(reader.hasFullResolution());
+  REQUIRE(reader.readTime(1) == 2.0);
+  REQUIRE(reader.getCellSize(2) == Catch::Approx(2.0));
+
+  std::vector<Writers::PyramidWriter::Record> records;
+
+  // Compare every point of every level with a direct reduction of the cells
+  for (unsigned int level = 0; level < reader.getNumLevels(); level++) {
+    const unsigned int width = 1u << level;
+    reader.readLevel(0, level, 0, reader.getLevelSize(level), records);
+    REQUIRE(records.size() == reader.getLevelSize(level));
+
+    for (unsigned int j = 0; j < records.size(); j++) {
+      const unsigned int begin = 1 + j * width;
+      const unsigned int end   = std::min(begin + width, size + 1);
+
+      std::vector<RealType> cells;
+      for (unsigned int i = begin; i < end; i++) {
+        cells.push_back(RealType((i * 7) % 11));
+      }
+
+      REQUIRE(records[j].hMin == *std::min_element(cells.begin(), cells.end()));
+      REQUIRE(records[j].hMax == *std::max_element(cells.begin(), cells.end()));
+      REQUIRE(records[j].hMean == Catch::Approx(std::accumulate(cells.begin(), cells.end(), RealType(0.0)) / cells.size()));
+      REQUIRE(records[j].huMax == -RealType(begin));
+    }
+  }
+
+  // A range of one level in the second frame
+  reader.readLevel(1, 2, 3, 100, records);
+  REQUIRE(records.size() == 7);
+  REQUIRE(records[0].hMean == Catch::Approx(3.0));
+  REQUIRE(records[0].huMin == -RealType(16));
+
+  std::remove("PyramidTest.lod");
+}
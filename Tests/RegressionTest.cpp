@@ -0,0 +1,200 @@
+/**
+ * RegressionTest.cpp
+ *
+ ****
+ **** Compares dam-break runs of all executors with stored golden solutions and the analytic Stoker solution.
+ ****
+ **** Set SWE1D_UPDATE_GOLDEN=1 to rewrite the golden files after an intended change of the results.
+ ****
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+#include "Runners/Simulation.hpp"
+#include "Runners/TaskGraphRunner.hpp"
+#include "Runners/ThreadPoolRunner.hpp"
+#include "Scenarios/DamBreakScenario.hpp"
+#include "Scenarios/Scenario.hpp"
+
+namespace {
+
+  constexpr double Gravity = 9.81;
+
+  /** Dam break on [0, 1000] with the dam at 500 */
+  class StokerScenario: public Scenarios::Scenario {
+  private:
+    unsigned int size_;
+    RealType     heightLeft_;
+    RealType     heightRight_;
+
+  public:
+    StokerScenario(unsigned int size, RealType heightLeft, RealType heightRight):
+      size_(size),
+      heightLeft_(heightLeft),
+      heightRight_(heightRight) {}
+
+    RealType getCellSize() const override { return RealType(1000) / size_; }
+    RealType getHeight(IndexType pos) const override { return pos <= size_ / 2 ? heightLeft_ : heightRight_; }
+  };
+
+  /**
+   * Analytic solution of the wet dam break (rarefaction to the left, shock to the right)
+   */
+  class StokerSolution {
+  private:
+    double heightLeft_;
+    double heightRight_;
+    /** Height and velocity between the rarefaction and the shock */
+    double heightMiddle_;
+    double velocityMiddle_;
+    double shockSpeed_;
+
+  public:
+    StokerSolution(double heightLeft, double heightRight):
+      heightLeft_(heightLeft),
+      heightRight_(heightRight) {
+
+      // The velocity behind the rarefaction must match the velocity behind the shock
+      double low  = heightRight;
+      double high = heightLeft;
+      for (unsigned int i = 0; i < 200; i++) {
+        const double h           = (low + high) / 2;
+        const double rarefaction = 2 * (std::sqrt(Gravity * heightLeft) - std::sqrt(Gravity * h));
+        const double shock       = (h - heightRight) * std::sqrt(Gravity / 2 * (1 / h + 1 / heightRight));
+        (rarefaction > shock ? low : high) = h;
+      }
+
+      heightMiddle_   = (low + high) / 2;
+      velocityMiddle_ = 2 * (std::sqrt(Gravity * heightLeft) - std::sqrt(Gravity * heightMiddle_));
+      shockSpeed_     = heightMiddle_ * velocityMiddle_ / (heightMiddle_ - heightRight);
+    }
+
+    /**
+     * @param xi (x - x_dam) / t
+     */
+    double getHeight(double xi) const {
+      const double celerityLeft = std::sqrt(Gravity * heightLeft_);
+
+      if (xi < -celerityLeft) {
+        return heightLeft_;
+      }
+      if (xi < velocityMiddle_ - std::sqrt(Gravity * heightMiddle_)) {
+        return (2 * celerityLeft - xi) * (2 * celerityLeft - xi) / (9 * Gravity);
+      }
+      if (xi < shockSpeed_) {
+        return heightMiddle_;
+      }
+      return heightRight_;
+    }
+  };
+
+  /**
+   * @return Relative L1 error of the water height at time t
+   */
+  double getStokerError(unsigned int size, RealType heightLeft, RealType heightRight, double t) {
+    StokerScenario      scenario(size, heightLeft, heightRight);
+    Runners::Simulation simulation(scenario, size);
+    simulation.setCheckInterval(0);
+    simulation.advanceTo(t);
+
+    const StokerSolution solution(heightLeft, heightRight);
+    const double         dx = scenario.getCellSize();
+
+    double error = 0;
+    double norm  = 0;
+    for (unsigned int i = 0; i < size; i++) {
+      const double exact = solution.getHeight(((i + 0.5) * dx - 500) / t);
+      error += std::abs(simulation.getHeight()[i] - exact);
+      norm += exact;
+    }
+
+    return error / norm;
+  }
+
+  std::string getGoldenFile(const std::string& name) { return std::string(SWE_TEST_DATA_DIR) + "/" + name + ".csv"; }
+
+  /**
+   * Compares h and hu with a golden file (or rewrites it if SWE1D_UPDATE_GOLDEN is set)
+   */
+  void checkGolden(const std::string& name, const Runners::Simulation& simulation) {
+    const char* update = std::getenv("SWE1D_UPDATE_GOLDEN");
+    if (update != nullptr && std::string(update) == "1") {
+      std::ofstream file(getGoldenFile(name));
+      file << std::setprecision(17);
+      for (unsigned int i = 0; i < simulation.getSize(); i++) {
+        file << simulation.getHeight()[i] << "," << simulation.getMomentum()[i] << "\n";
+      }
+      return;
+    }
+
+    std::ifstream file(getGoldenFile(name));
+    REQUIRE(file.good());
+
+    // Optimized engines may reorder operations, but must not change the results beyond rounding
+    const double tolerance = sizeof(RealType) == sizeof(double) ? 1e-9 : 1e-3;
+
+    std::string line;
+    for (unsigned int i = 0; i < simulation.getSize(); i++) {
+      REQUIRE(std::getline(file, line));
+      const std::size_t comma = line.find(',');
+      const double      h     = std::stod(line.substr(0, comma));
+      const double      hu    = std::stod(line.substr(comma + 1));
+
+      REQUIRE(std::abs(simulation.getHeight()[i] - h) <= tolerance * std::abs(h) + tolerance);
+      REQUIRE(std::abs(simulation.getMomentum()[i] - hu) <= tolerance * std::abs(hu) + tolerance);
+    }
+  }
+
+} // namespace
+
+TEST_CASE("All executors reproduce the golden dam break", "RegressionTest") {
+  constexpr unsigned int Size     = 400;
+  constexpr unsigned int NumSteps = 150;
+
+  Scenarios::DamBreakScenario scenario(Size);
+
+  SECTION("sequential") {
+    Runners::Simulation simulation(scenario, Size);
+    for (unsigned int i = 0; i < NumSteps; i++) {
+      simulation.step();
+    }
+    checkGolden("DamBreak400", simulation);
+  }
+
+  SECTION("taskgraph") {
+    Runners::Simulation      simulation(scenario, Size);
+    Runners::TaskGraphRunner runner(simulation, 3, 64);
+    runner.run(NumSteps);
+    checkGolden("DamBreak400", simulation);
+  }
+
+  SECTION("pool") {
+    Runners::Simulation       simulation(scenario, Size);
+    Runners::ThreadPoolRunner runner(simulation, 3, false);
+    runner.run(NumSteps);
+    checkGolden("DamBreak400", simulation);
+  }
+}
+
+TEST_CASE("The dam break converges to the Stoker solution", "RegressionTest") {
+  SECTION("runnerScenario") {
+    // Same depths as DamBreakScenario, the waves do not reach the boundaries until t = 40
+    const double coarse = getStokerError(500, 15, 10, 20);
+    const double fine   = getStokerError(2000, 15, 10, 20);
+
+    REQUIRE(fine < 2e-3);
+    // First order at the shock and the kinks of the rarefaction
+    REQUIRE(fine < coarse / 2);
+  }
+
+  SECTION("strongShock") {
+    const double error = getStokerError(2000, 10, RealType(0.5), 15);
+    REQUIRE(error < 1e-2);
+  }
+}
@@ -0,0 +1,92 @@
+/**
+ * SharedMemoryTest.cpp
+ *
+ ****
+ **** Publishes frames to the shared memory ring buffer and reads them back, also concurrently.
+ ****
+ */
+
+#include <atomic>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include "Tools/SharedMemoryReader.hpp"
+#include "Writers/SharedMemoryWriter.hpp"
+
+TEST_CASE("Frames are downsampled and read back", "SharedMemoryTest") {
+  const std::string name = "SWE1D-test-" + std::to_string(getpid());
+
+  // 10 cells with 4 points -> 3 cells per point
+  Writers::SharedMemoryWriter writer(name, RealType(2.0), 10, 4, 2);
+  Tools::SharedMemoryReader   reader(name);
+
+  Tools::SharedMemoryReader::Frame frame;
+  REQUIRE_FALSE(reader.readLatest(frame));
+  REQUIRE(reader.getCellSize() == Catch::Approx(6.0));
+
+  std::vector<RealType> h(12), hu(12);
+  for (unsigned int i = 1; i < 11; i++) {
+    h[i]  = RealType(i);
+    hu[i] = RealType(2 * i);
+  }
+
+  writer.write(RealType(0.5), h.data(), hu.data(), 10);
+  writer.write(RealType(1.5), h.data(), hu.data(), 10);
+  writer.write(RealType(2.5), h.data(), hu.data(), 10);
+
+  REQUIRE(reader.getNumFrames() == 3);
+  REQUIRE(reader.readLatest(frame));
+  REQUIRE(frame.number == 2);
+  REQUIRE(frame.time == Catch::Approx(2.5));
+
+  REQUIRE(frame.h.size() == 4);
+  REQUIRE(frame.h[0] == Catch::Approx(2.0));
+  REQUIRE(frame.h[3] == Catch::Approx(10.0));
+  REQUIRE(frame.hu[1] == Catch::Approx(10.0));
+
+  REQUIRE(frame.mass == Catch::Approx(110.0));
+  REQUIRE(frame.momentum == Catch::Approx(220.0));
+  REQUIRE(frame.maxHeight == Catch::Approx(10.0));
+  REQUIRE(frame.maxSpeed == Catch::Approx(2.0));
+}
+
+TEST_CASE("The reader never sees a partially written frame", "SharedMemoryTest") {
+  const std::string name = "SWE1D-test-concurrent-" + std::to_string(getpid());
+
+  Writers::SharedMemoryWriter writer(name, RealType(1.0), 5000, 1000, 2);
+  Tools::SharedMemoryReader   reader(name);
+
+  std::atomic<bool> done(false);
+
+  // Every frame contains its time in all cells
+  std::thread writerThread([&] {
+    std::vector<RealType> h(5002), hu(5002);
+    for (unsigned int f = 1; f < 2000; f++) {
+      std::fill(h.begin(), h.end(), RealType(f));
+      std::fill(hu.begin(), hu.end(), RealType(f));
+      writer.write(RealType(f), h.data(), hu.data(), 5000);
+    }
+    done = true;
+  });
+
+  Tools::SharedMemoryReader::Frame frame;
+  unsigned int                     numTorn = 0;
+  while (!done) {
+    if (reader.readLatest(frame)) {
+      for (unsigned int i = 0; i < frame.h.size(); i++) {
+        if (frame.h[i] != RealType(frame.time) || frame.hu[i] != RealType(frame.time)) {
+          numTorn++;
+        }
+      }
+    }
+  }
+  writerThread.join();
+
+  REQUIRE(numTorn == 0);
+  REQUIRE(reader.readLatest(frame));
+  REQUIRE(frame.time == Catch::Approx(1999.0));
+}
@@ -0,0 +1,131 @@
+/**
+ * SimulationServerTest.cpp
+ *
+ ****
+ **** Sends run requests to the simulation server and compares the results with local simulations.
+ ****
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <charconv>
+#include <string>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include "Runners/Simulation.hpp"
+#include "Runners/SimulationServer.hpp"
+#include "Scenarios/DamBreakScenario.hpp"
+
+namespace {
+
+  /** Minimal blocking client, one request at a time */
+  class Client {
+    int         socket_;
+    std::string input_;
+
+  public:
+    Client(const std::string& path):
+      socket_(socket(AF_UNIX, SOCK_STREAM, 0)) {
+      sockaddr_un address = {};
+      address.sun_family  = AF_UNIX;
+      path.copy(address.sun_path, sizeof(address.sun_path) - 1);
+      connect(socket_, reinterpret_cast<const sockaddr*>(&address), sizeof(address));
+    }
+
+    ~Client() { close(socket_); }
+
+    /**
+     * @return All lines of the response without the final "END"
+     */
+    std::vector<std::string> request(const std::string& line) {
+      const std::string message = line + "\n";
+      send(socket_, message.data(), message.size(), MSG_NOSIGNAL);
+
+      std::vector<std::string> lines;
+      while (true) {
+        const std::size_t newline = input_.find('\n');
+        if (newline == std::string::npos) {
+          char          buffer[4096];
+          const ssize_t n = recv(socket_, buffer, sizeof(buffer), 0);
+          if (n <= 0) {
+            return lines;
+          }
+          input_.append(buffer, static_cast<std::size_t>(n));
+          continue;
+        }
+
+        std::string response = input_.substr(0, newline);
+        input_.erase(0, newline + 1);
+        if (response == "END") {
+          return lines;
+        }
+        lines.push_back(response);
+      }
+    }
+  };
+
+  /**
+   * @return The value of key=value in a response line
+   */
+  RealType getValue(const std::string& line, const std::string& key) {
+    const std::size_t begin = line.find(" " + key + "=") + key.size() + 2;
+    RealType          value = 0;
+    std::from_chars(line.data() + begin, line.data() + line.size(), value);
+    return value;
+  }
+
+} // namespace
+
+TEST_CASE("The server answers run requests like local simulations", "SimulationServerTest") {
+  const std::string socketPath = "SimulationServerTest.sock";
+
+  Runners::SimulationServer server(socketPath, 2, 200);
+  REQUIRE(server.getNumWorkers() == 2);
+  std::thread thread([&server] { server.run(); });
+
+  Scenarios::DamBreakScenario scenario(200, 12, 8);
+  Runners::Simulation         simulation(scenario, 200);
+  simulation.getBlock().setDiagnosticsEnabled(true);
+  simulation.advanceTo(5.0);
+
+  {
+    Client client(socketPath);
+
+    // The second request reuses the buffers of the first one
+    for (unsigned int i = 0; i < 2; i++) {
+      const std::vector<std::string> response = client.request("RUN size=200 end=5 left=12 right=8 output=field");
+      REQUIRE(response.size() == 202);
+      CHECK(response[0] == "FRAME time=5 size=200");
+      CHECK(response[1] == "12 0");
+      CHECK(response[201].starts_with("SUMMARY"));
+      CHECK(getValue(response[201], "steps") == simulation.getStep());
+      CHECK(getValue(response[201], "mass") == simulation.getBlock().getDiagnostics().mass);
+      CHECK(getValue(response[201], "maxSpeed") == simulation.getBlock().getDiagnostics().maxSpeed);
+    }
+
+    // Streamed frames of every 4th step, no final frame after step 8
+    const std::vector<std::string> frames = client.request("RUN size=50 steps=8 interval=4");
+    REQUIRE(frames.size() == 2 * 51 + 1);
+    CHECK(frames[51].starts_with("FRAME"));
+
+    CHECK(client.request("RUN size=100 friction=manning") == std::vector<std::string>{"ERROR invalid value of friction"});
+    CHECK(client.request("RUN size=100") == std::vector<std::string>{"ERROR missing end or steps"});
+    CHECK(client.request("HELLO") == std::vector<std::string>{"ERROR unknown command HELLO"});
+
+    const std::vector<std::string> stats = client.request("STATS");
+    REQUIRE(stats.size() == 1);
+    CHECK(getValue(stats[0], "requests") == 3);
+    CHECK(getValue(stats[0], "dispatch_p50") <= getValue(stats[0], "dispatch_max"));
+    CHECK(getValue(stats[0], "total_p50") <= getValue(stats[0], "total_max"));
+
+    CHECK(client.request("SHUTDOWN") == std::vector<std::string>{"OK"});
+  }
+
+  thread.join();
+  CHECK(server.getTotalLatencies().count == 3);
+  CHECK(server.getDispatchLatencies().p50 <= server.getTotalLatencies().p50);
+}
@@ -0,0 +1,37 @@
+/**
+ * SimulationTest.cpp
+ *
+ ****
+ **** Drives the embeddable simulation object without the runner.
+ ****
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "Runners/Simulation.hpp"
+#include "Scenarios/DamBreakScenario.hpp"
+
+TEST_CASE("The simulation can be advanced to a given time", "SimulationTest") {
+  Scenarios::DamBreakScenario scenario(200);
+  Runners::Simulation         simulation(scenario, 200);
+
+  SECTION("zeroCopyViews") {
+    REQUIRE(simulation.getHeight().size() == 200);
+    REQUIRE(simulation.getHeight()[0] == 15);
+    REQUIRE(simulation.getHeight()[199] == 10);
+
+    simulation.getMomentum()[10] = 1;
+    REQUIRE(simulation.getMomentum()[10] == 1);
+    simulation.getMomentum()[10] = 0;
+  }
+
+  SECTION("advanceTo") {
+    const unsigned int numSteps = simulation.advanceTo(2.5);
+    REQUIRE(numSteps > 1);
+    REQUIRE(simulation.getTime() == 2.5);
+    REQUIRE(simulation.getStep() == numSteps);
+
+    simulation.advanceTo(3.0);
+    REQUIRE(simulation.getTime() == 3.0);
+  }
+}
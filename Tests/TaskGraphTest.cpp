@@ -0,0 +1,96 @@
+/**
+ * TaskGraphTest.cpp
+ *
+ ****
+ **** Checks the task graph executor and the pipelined runner against the sequential steps.
+ ****
+ */
+
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+
+#include "Runners/Simulation.hpp"
+#include "Runners/TaskGraphRunner.hpp"
+#include "Scenarios/DamBreakScenario.hpp"
+#include "Tools/TaskGraph.hpp"
+#include "Writers/Writer.hpp"
+
+namespace {
+
+  /** Remembers the time and the mass of every output */
+  class RecordingWriter: public Writers::Writer {
+  public:
+    std::vector<double>   times;
+    std::vector<RealType> masses;
+
+    void write(const RealType time, const RealType* h, const RealType* /*hu*/, IndexType size) override {
+      RealType mass = 0;
+      for (unsigned int i = 1; i < size + 1; i++) {
+        mass += h[i];
+      }
+
+      times.push_back(time);
+      masses.push_back(mass);
+    }
+  };
+
+} // namespace
+
+TEST_CASE("Tasks run after their predecessors", "TaskGraphTest") {
+  Tools::TaskGraph graph(4);
+
+  std::atomic<unsigned int> counter(0);
+  std::vector<unsigned int> order(6);
+
+  // Diamond: 0 -> {1, 2, 3} -> 4 -> 5
+  const auto first = graph.addTask([&] { order[0] = counter++; });
+  std::vector<Tools::TaskGraph::TaskId> middle;
+  for (unsigned int i = 1; i < 4; i++) {
+    middle.push_back(graph.addTask([&, i] { order[i] = counter++; }, {first}));
+  }
+  const auto join = graph.addTask([&] { order[4] = counter++; }, middle);
+  graph.addTask([&] { order[5] = counter++; }, {join});
+
+  // The same graph can be run several times
+  for (unsigned int run = 0; run < 3; run++) {
+    counter = 0;
+    graph.run();
+
+    REQUIRE(counter == 6);
+    REQUIRE(order[0] == 0);
+    REQUIRE(order[4] == 4);
+    REQUIRE(order[5] == 5);
+  }
+}
+
+TEST_CASE("The task graph runner matches the sequential steps", "TaskGraphTest") {
+  Scenarios::DamBreakScenario scenario(500);
+
+  Runners::Simulation sequential(scenario, 500);
+  Runners::Simulation pipelined(scenario, 500);
+
+  RecordingWriter sequentialWriter;
+  RecordingWriter pipelinedWriter;
+  sequential.addWriter(sequentialWriter, 3);
+  pipelined.addWriter(pipelinedWriter, 3);
+
+  for (unsigned int i = 0; i < 40; i++) {
+    sequential.step();
+  }
+
+  // Small chunks and batches to exercise the dependencies across chunks and batches
+  Runners::TaskGraphRunner runner(pipelined, 3, 17);
+  runner.run(40, 16);
+
+  REQUIRE(pipelined.getStep() == sequential.getStep());
+  REQUIRE(pipelined.getTime() == sequential.getTime());
+
+  for (unsigned int i = 0; i < 500; i++) {
+    REQUIRE(pipelined.getHeight()[i] == sequential.getHeight()[i]);
+    REQUIRE(pipelined.getMomentum()[i] == sequential.getMomentum()[i]);
+  }
+
+  REQUIRE(pipelinedWriter.times == sequentialWriter.times);
+  REQUIRE(pipelinedWriter.masses == sequentialWriter.masses);
+}
@@ -0,0 +1,71 @@
+/**
+ * ThreadPoolTest.cpp
+ *
+ ****
+ **** Checks the thread pool runner with neighbour synchronisation against the sequential steps.
+ ****
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+
+#include "Blocks/BoundaryConditions.hpp"
+#include "Runners/Simulation.hpp"
+#include "Runners/ThreadPoolRunner.hpp"
+#include "Scenarios/DamBreakScenario.hpp"
+#include "Writers/Writer.hpp"
+
+namespace {
+
+  /** Remembers the time of every output */
+  class TimeWriter: public Writers::Writer {
+  public:
+    std::vector<double> times;
+
+    void write(const RealType time, const RealType* /*h*/, const RealType* /*hu*/, IndexType /*size*/) override { times.push_back(time); }
+  };
+
+} // namespace
+
+TEST_CASE("The thread pool runner matches the sequential steps", "ThreadPoolTest") {
+  Scenarios::DamBreakScenario scenario(301);
+
+  // Periodic boundaries couple the first and the last thread
+  Blocks::PeriodicBoundary periodic;
+
+  Runners::Simulation sequential(scenario, 301);
+  Runners::Simulation pooled(scenario, 301);
+  sequential.setBoundaryConditions(&periodic, &periodic);
+  pooled.setBoundaryConditions(&periodic, &periodic);
+
+  // Only every 25th step needs all threads
+  sequential.setCheckInterval(0);
+  pooled.setCheckInterval(0);
+
+  TimeWriter sequentialWriter;
+  TimeWriter pooledWriter;
+  sequential.addWriter(sequentialWriter, 25);
+  pooled.addWriter(pooledWriter, 25);
+
+  for (unsigned int i = 0; i < 100; i++) {
+    sequential.step();
+  }
+
+  // Thread counts that are no power of two need the dissemination all-reduce
+  Runners::ThreadPoolRunner runner(pooled, 5, false);
+  REQUIRE(runner.getNumThreads() == 5);
+
+  // The counters continue across runs
+  runner.run(60);
+  runner.run(40);
+
+  REQUIRE(pooled.getStep() == sequential.getStep());
+  REQUIRE(pooled.getTime() == sequential.getTime());
+
+  for (unsigned int i = 0; i < 301; i++) {
+    REQUIRE(pooled.getHeight()[i] == sequential.getHeight()[i]);
+    REQUIRE(pooled.getMomentum()[i] == sequential.getMomentum()[i]);
+  }
+
+  REQUIRE(pooledWriter.times == sequentialWriter.times);
+}
@@ -0,0 +1,124 @@
+/**
+ * ThroughputTest.cpp
+ *
+ ****
+ **** Guards the throughput (cells/s) of all executors against a per-machine baseline.
+ ****
+ **** The baseline file (SWE1D_THROUGHPUT_BASELINE, set by CMake) is created by the first run. A measurement
+ **** fails if it is below the baseline by more than SWE1D_THROUGHPUT_SLACK (relative). Set
+ **** SWE1D_UPDATE_BASELINE=1 to store the current measurements, e.g. after a deliberate change.
+ ****
+ */
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <string>
+
+#include "Runners/Simulation.hpp"
+#include "Runners/TaskGraphRunner.hpp"
+#include "Runners/ThreadPoolRunner.hpp"
+#include "Scenarios/DamBreakScenario.hpp"
+
+namespace {
+
+  constexpr unsigned int Size       = 1 << 19;
+  constexpr unsigned int NumSteps   = 20;
+  constexpr unsigned int NumRepeats = 3;
+
+  std::string getEnvironment(const char* name, const std::string& defaultValue) {
+    const char* value = std::getenv(name);
+    return value != nullptr ? std::string(value) : defaultValue;
+  }
+
+  std::map<std::string, double> readBaseline(const std::string& fileName) {
+    std::map<std::string, double> baseline;
+
+    std::ifstream file(fileName);
+    std::string   name;
+    double        cellsPerSecond;
+    while (file >> name) {
+      if (name[0] == '#') {
+        file.ignore(1 << 16, '\n');
+        continue;
+      }
+      if (file >> cellsPerSecond) {
+        baseline[name] = cellsPerSecond;
+      }
+    }
+
+    return baseline;
+  }
+
+  void writeBaseline(const std::string& fileName, const std::map<std::string, double>& baseline) {
+    std::ofstream file(fileName);
+    file << "# SWE1D throughput baseline in cells/s (" << Size << " cells, best of " << NumRepeats << " x " << NumSteps << " steps)" << std::endl;
+    for (const auto& [name, cellsPerSecond] : baseline) {
+      file << name << " " << cellsPerSecond << std::endl;
+    }
+  }
+
+  /**
+   * @return Best throughput of several repetitions of run(simulation)
+   */
+  double measure(const std::function<void(Runners::Simulation&)>& run) {
+    Scenarios::DamBreakScenario scenario(Size);
+    Runners::Simulation         simulation(scenario, Size);
+    simulation.setCheckInterval(0);
+
+    double best = 0;
+    for (unsigned int i = 0; i < NumRepeats; i++) {
+      simulation.reset(scenario);
+
+      const auto start = std::chrono::steady_clock::now();
+      run(simulation);
+      const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+
+      best = std::max(best, double(Size) * NumSteps / duration.count());
+    }
+
+    return best;
+  }
+
+} // namespace
+
+TEST_CASE("The throughput does not regress", "ThroughputTest") {
+  const std::string fileName = getEnvironment("SWE1D_THROUGHPUT_BASELINE", "ThroughputBaseline.txt");
+  const double      slack    = std::stod(getEnvironment("SWE1D_THROUGHPUT_SLACK", "0.25"));
+  const bool        update   = getEnvironment("SWE1D_UPDATE_BASELINE", "0") == "1";
+
+  std::map<std::string, double> measurements;
+  measurements["sequential"] = measure([](Runners::Simulation& simulation) {
+    for (unsigned int i = 0; i < NumSteps; i++) {
+      simulation.step();
+    }
+  });
+  measurements["taskgraph"]  = measure([](Runners::Simulation& simulation) { Runners::TaskGraphRunner(simulation, 0).run(NumSteps); });
+  measurements["pool"]       = measure([](Runners::Simulation& simulation) { Runners::ThreadPoolRunner(simulation, 0).run(NumSteps); });
+
+  std::map<std::string, double> baseline = readBaseline(fileName);
+
+  bool modified = false;
+  for (const auto& [name, cellsPerSecond] : measurements) {
+    std::cout << name << ": " << cellsPerSecond << " cells/s";
+
+    if (update || baseline.count(name) == 0) {
+      std::cout << " (new baseline)" << std::endl;
+      baseline[name] = cellsPerSecond;
+      modified       = true;
+      continue;
+    }
+
+    std::cout << ", baseline " << baseline[name] << " cells/s" << std::endl;
+    CHECK(cellsPerSecond >= (1 - slack) * baseline[name]);
+  }
+
+  if (modified) {
+    writeBaseline(fileName, baseline);
+  }
+}
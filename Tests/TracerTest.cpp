@@ -0,0 +1,159 @@
+/**
+ * TracerTest.cpp
+ *
+ ****
+ **** Transports passive tracers with the mass flux of the dam break and checks consistency, conservation and bounds.
+ ****
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include "Blocks/BoundaryConditions.hpp"
+#include "Blocks/WavePropagationBlock.hpp"
+#include "Scenarios/DamBreakScenario.hpp"
+
+namespace {
+
+  constexpr IndexType Size = 200;
+
+  /** Round-off tolerance of the precision in use */
+  constexpr RealType Tolerance = 100 * std::numeric_limits<RealType>::epsilon();
+
+  /** Dam break state with two tracers: a uniform concentration and a step at the dam */
+  struct State {
+    std::vector<RealType> h;
+    std::vector<RealType> hu;
+    std::vector<RealType> uniform;
+    std::vector<RealType> step;
+
+    State():
+      h(Size + 2),
+      hu(Size + 2),
+      uniform(Size + 2),
+      step(Size + 2) {
+      Scenarios::DamBreakScenario scenario(Size);
+      for (IndexType i = 0; i < Size + 2; i++) {
+        h[i]       = scenario.getHeight(i);
+        hu[i]      = scenario.getMomentum(i);
+        uniform[i] = RealType(0.5) * h[i];
+        step[i]    = i <= Size / 2 ? h[i] : RealType(0.0);
+      }
+    }
+  };
+
+  RealType sum(const std::vector<RealType>& values) { return std::accumulate(values.begin() + 1, values.end() - 1, RealType(0.0)); }
+
+} // namespace
+
+TEST_CASE("Tracers are transported with the mass flux", "TracerTest") {
+  Blocks::ReflectiveBoundary reflective;
+
+  State                                state;
+  Blocks::BasicWavePropagationBlock<2> block(state.h.data(), state.hu.data(), Size, RealType(5.0), {state.uniform.data(), state.step.data()});
+  block.setBoundaryConditions(&reflective, &reflective);
+
+  // Reference without tracers
+  State                        reference;
+  Blocks::WavePropagationBlock referenceBlock(reference.h.data(), reference.hu.data(), Size, RealType(5.0));
+  referenceBlock.setBoundaryConditions(&reflective, &reflective);
+
+  const RealType stepMass = sum(state.step);
+
+  for (unsigned int i = 0; i < 300; i++) {
+    block.applyBoundaryConditions(0.0);
+    const RealType dt = block.computeNumericalFluxes();
+    block.updateUnknowns(dt);
+
+    referenceBlock.applyBoundaryConditions(0.0);
+    REQUIRE(referenceBlock.computeNumericalFluxes() == dt);
+    referenceBlock.updateUnknowns(dt);
+  }
+
+  // The tracers do not change the hydrodynamics
+  CHECK(state.h == reference.h);
+  CHECK(state.hu == reference.hu);
+
+  RealType maxDeviation     = 0;
+  RealType minConcentration = 1;
+  RealType maxConcentration = 0;
+  for (IndexType i = 1; i < Size + 1; i++) {
+    maxDeviation     = std::max(maxDeviation, std::abs(state.uniform[i] / state.h[i] - RealType(0.5)));
+    minConcentration = std::min(minConcentration, state.step[i] / state.h[i]);
+    maxConcentration = std::max(maxConcentration, state.step[i] / state.h[i]);
+  }
+
+  // A uniform concentration stays uniform
+  CHECK(maxDeviation < Tolerance);
+
+  // Upwinding keeps the concentration bounded, the walls conserve the tracer
+  CHECK(minConcentration >= RealType(0.0));
+  CHECK(maxConcentration <= RealType(1.0) + Tolerance);
+  CHECK(std::abs(sum(state.step) - stepMass) < stepMass * Tolerance);
+
+  // The tracer has been mixed across the dam
+  CHECK(state.step[Size / 2 + 10] > RealType(0.0));
+}
+
+TEST_CASE("Periodic tracers wrap around", "TracerTest") {
+  Blocks::PeriodicBoundary periodic;
+
+  State                                state;
+  Blocks::BasicWavePropagationBlock<1> block(state.h.data(), state.hu.data(), Size, RealType(5.0), {state.step.data()});
+  block.setBoundaryConditions(&periodic, &periodic);
+
+  const RealType stepMass = sum(state.step);
+
+  REQUIRE(state.step[Size] == RealType(0.0));
+  for (unsigned int i = 0; i < 1000; i++) {
+    block.applyBoundaryConditions(0.0);
+    block.updateUnknowns(block.computeNumericalFluxes());
+  }
+
+  CHECK(std::abs(sum(state.step) - stepMass) < stepMass * Tolerance);
+  // The second dam at the periodic boundary carries the tracer from the first into the last cell
+  CHECK(state.step[Size] > RealType(0.0));
+}
+
+TEST_CASE("A uniform concentration stays uniform next to a shoreline", "TracerTest") {
+  Blocks::ReflectiveBoundary reflective;
+
+  // Deep water at rest on the left, a moving layer below the dry tolerance of the solver on the right
+  State state;
+  for (IndexType i = 0; i < Size + 2; i++) {
+    state.h[i]       = i <= Size / 2 ? RealType(2.0) : RealType(0.005);
+    state.hu[i]      = i <= Size / 2 ? RealType(0.0) : RealType(0.005);
+    state.uniform[i] = RealType(0.5) * state.h[i];
+    state.step[i]    = i <= Size / 4 || i > 3 * Size / 4 ? state.h[i] : RealType(0.0);
+  }
+
+  Blocks::BasicWavePropagationBlock<2> block(state.h.data(), state.hu.data(), Size, RealType(5.0), {state.uniform.data(), state.step.data()});
+  block.setBoundaryConditions(&reflective, &reflective);
+
+  for (unsigned int i = 0; i < 300; i++) {
+    block.applyBoundaryConditions(0.0);
+    block.updateUnknowns(block.computeNumericalFluxes());
+  }
+
+  RealType maxDeviation     = 0;
+  RealType minConcentration = 1;
+  RealType maxConcentration = 0;
+  for (IndexType i = 1; i < Size + 1; i++) {
+    maxDeviation     = std::max(maxDeviation, std::abs(state.uniform[i] / state.h[i] - RealType(0.5)));
+    minConcentration = std::min(minConcentration, state.step[i] / state.h[i]);
+    maxConcentration = std::max(maxConcentration, state.step[i] / state.h[i]);
+  }
+
+  // The solver treats the layer as dry, so the mass fluxes differ on both sides of its edges
+  REQUIRE(state.h[Size - 10] == RealType(0.005));
+  REQUIRE(state.hu[Size - 10] == RealType(0.005));
+
+  CHECK(maxDeviation < Tolerance);
+  CHECK(minConcentration >= RealType(0.0));
+  CHECK(maxConcentration <= RealType(1.0) + Tolerance);
+}
@@ -0,0 +1,119 @@
+/**
+ * VTKWriterTest.cpp
+ *
+ ****
+ **** Compares the pieces of the partitioned VTK output with a single .vtr file.
+ ****
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Scenarios/DamBreakScenario.hpp"
+#include "Writers/VTKWriter.hpp"
+
+namespace {
+
+  std::string readFile(const std::string& fileName) {
+    std::ifstream     file(fileName);
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+  }
+
+  /**
+   * @return The lines of the first data array that starts with the given tag
+   *  (the x coordinates for an unnamed array)
+   */
+  std::vector<std::string> readArray(const std::string& content, const std::string& tag) {
+    std::vector<std::string> values;
+
+    std::istringstream stream(content.substr(content.find(tag)));
+    std::string        line;
+    std::getline(stream, line);
+    while (std::getline(stream, line) && line != "</DataArray>") {
+      values.push_back(line);
+    }
+
+    return values;
+  }
+
+} // namespace
+
+TEST_CASE("The VTK pieces contain the same grid as a single file", "VTKWriterTest") {
+  constexpr IndexType Size = 103;
+
+  Scenarios::DamBreakScenario scenario(Size);
+
+  std::vector<RealType> h(Size + 2);
+  std::vector<RealType> hu(Size + 2);
+  for (IndexType i = 0; i < Size + 2; i++) {
+    h[i]  = scenario.getHeight(i);
+    hu[i] = RealType(0.5) * i;
+  }
+
+  {
+    Writers::VTKWriter single("VTKWriterTest_single", scenario.getCellSize());
+    Writers::VTKWriter pieces("VTKWriterTest_pieces", scenario.getCellSize(), 4);
+    single.write(0, h.data(), hu.data(), Size);
+    pieces.write(0, h.data(), hu.data(), Size);
+  }
+
+  const std::string reference = readFile("VTKWriterTest_single_0.vtr");
+  const std::string parallel  = readFile("VTKWriterTest_pieces_0.pvtr");
+  REQUIRE(!reference.empty());
+  REQUIRE(!parallel.empty());
+
+  // The collection references the .pvtr file
+  CHECK(readFile("VTKWriterTest_pieces.vtp").find("file=\"VTKWriterTest_pieces_0.pvtr\"") != std::string::npos);
+
+  // 103 cells in 4 balanced pieces
+  CHECK(parallel.find("WholeExtent=\"0 103 0 0 0 0\"") != std::string::npos);
+  CHECK(parallel.find("<Piece Extent=\"0 26 0 0 0 0\" Source=\"VTKWriterTest_pieces_0_0.vtr\"/>") != std::string::npos);
+  CHECK(parallel.find("<Piece Extent=\"26 52 0 0 0 0\" Source=\"VTKWriterTest_pieces_0_1.vtr\"/>") != std::string::npos);
+  CHECK(parallel.find("<Piece Extent=\"52 78 0 0 0 0\" Source=\"VTKWriterTest_pieces_0_2.vtr\"/>") != std::string::npos);
+  CHECK(parallel.find("<Piece Extent=\"78 103 0 0 0 0\" Source=\"VTKWriterTest_pieces_0_3.vtr\"/>") != std::string::npos);
+
+  std::vector<std::string> coordinates;
+  std::vector<std::string> heights;
+  std::vector<std::string> momenta;
+  for (unsigned int p = 0; p < 4; p++) {
+    const std::string        piece            = readFile("VTKWriterTest_pieces_0_" + std::to_string(p) + ".vtr");
+    std::vector<std::string> pieceCoordinates = readArray(piece, "<DataArray type=\"Float32\"");
+    std::vector<std::string> pieceHeights     = readArray(piece, "<DataArray Name=\"h\"");
+    std::vector<std::string> pieceMomenta     = readArray(piece, "<DataArray Name=\"hu\"");
+
+    // Neighbouring pieces share the point on their border
+    if (p > 0) {
+      CHECK(coordinates.back() == pieceCoordinates.front());
+      coordinates.pop_back();
+    }
+    coordinates.insert(coordinates.end(), pieceCoordinates.begin(), pieceCoordinates.end());
+    heights.insert(heights.end(), pieceHeights.begin(), pieceHeights.end());
+    momenta.insert(momenta.end(), pieceMomenta.begin(), pieceMomenta.end());
+  }
+
+  CHECK(coordinates == readArray(reference, "<DataArray type=\"Float32\""));
+  CHECK(heights == readArray(reference, "<DataArray Name=\"h\""));
+  CHECK(momenta == readArray(reference, "<DataArray Name=\"hu\""));
+}
+
+TEST_CASE("Small grids are split into at most one piece per cell", "VTKWriterTest") {
+  std::vector<RealType> h  = {1, 2, 3, 4};
+  std::vector<RealType> hu = {0, 0, 0, 0};
+
+  {
+    Writers::VTKWriter writer("VTKWriterTest_small", 1, 8);
+    writer.write(0, h.data(), hu.data(), 2);
+  }
+
+  const std::string parallel = readFile("VTKWriterTest_small_0.pvtr");
+  CHECK(parallel.find("<Piece Extent=\"0 1 0 0 0 0\" Source=\"VTKWriterTest_small_0_0.vtr\"/>") != std::string::npos);
+  CHECK(parallel.find("<Piece Extent=\"1 2 0 0 0 0\" Source=\"VTKWriterTest_small_0_1.vtr\"/>") != std::string::npos);
+  CHECK(parallel.find("VTKWriterTest_small_0_2.vtr") == std::string::npos);
+  CHECK(readArray(readFile("VTKWriterTest_small_0_1.vtr"), "<DataArray Name=\"h\"") == std::vector<std::string>{"3"});
+}